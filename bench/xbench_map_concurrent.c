@@ -0,0 +1,176 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+#include <fossil/xstructures.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Scaling benchmark for concurrent maps. Every thread count from 1 to 64 runs
+// the same read-mostly mix against a single-shard map, which behaves like
+// one lock around the whole map, a map split into many locked shards and a
+// read-mostly map whose readers take no lock.
+//
+// usage: xbench_map_concurrent [keys] [ops-per-thread] [write-percent]
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+typedef HANDLE bench_thread;
+#define BENCH_THREAD_RETURN DWORD WINAPI
+#else
+#include <pthread.h>
+#include <time.h>
+typedef pthread_t bench_thread;
+#define BENCH_THREAD_RETURN void*
+#endif
+
+#define BENCH_MAX_THREADS 64
+#define BENCH_SHARDS 256
+
+typedef struct {
+    cmap* map;
+    size_t keys;
+    size_t ops;
+    unsigned write_percent;
+    uint64_t seed;
+    size_t found;
+} bench_worker;
+
+// Helper function to read a monotonic clock in seconds
+static double bench_now(void) {
+#if defined(_WIN32)
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+#endif
+}
+
+// Helper function to step a xorshift generator
+static uint64_t bench_next(uint64_t* state) {
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+    return x;
+}
+
+static BENCH_THREAD_RETURN bench_run(void* arg) {
+    bench_worker* worker = (bench_worker*)arg;
+    uint64_t state = worker->seed;
+    size_t found = 0;
+
+    for (size_t i = 0; i < worker->ops; i++) {
+        uint64_t draw = bench_next(&state);
+        ctofu key = { TOFU_INT_TYPE, { .int_type = (int)(draw % worker->keys) } };
+        if ((draw >> 32) % 100 < worker->write_percent) {
+            ctofu value = { TOFU_INT_TYPE, { .int_type = (int)i } };
+            fscl_map_upsert(worker->map, key, value);
+        } else {
+            ctofu value;
+            found += fscl_map_getter(worker->map, key, &value) == TOFU_SUCCESS;
+        }
+    }
+
+    worker->found = found;
+    return 0;
+}
+
+// Helper function to time threads workers against map, in operations per second
+static double bench_measure(cmap* map, size_t threads, size_t keys, size_t ops, unsigned write_percent) {
+    bench_thread handles[BENCH_MAX_THREADS];
+    bench_worker workers[BENCH_MAX_THREADS];
+
+    double start = bench_now();
+    for (size_t t = 0; t < threads; t++) {
+        workers[t].map = map;
+        workers[t].keys = keys;
+        workers[t].ops = ops;
+        workers[t].write_percent = write_percent;
+        workers[t].seed = 0x9e3779b97f4a7c15ULL * (t + 1);
+        workers[t].found = 0;
+#if defined(_WIN32)
+        handles[t] = CreateThread(NULL, 0, bench_run, &workers[t], 0, NULL);
+#else
+        pthread_create(&handles[t], NULL, bench_run, &workers[t]);
+#endif
+    }
+    for (size_t t = 0; t < threads; t++) {
+#if defined(_WIN32)
+        WaitForSingleObject(handles[t], INFINITE);
+        CloseHandle(handles[t]);
+#else
+        pthread_join(handles[t], NULL);
+#endif
+    }
+    double elapsed = bench_now() - start;
+
+    return (double)(threads * ops) / elapsed;
+}
+
+// Helper function to build a map with the given constructor holding every key
+static cmap* bench_fill(cmap* (*create)(ctofu_type, size_t), size_t shards, size_t keys) {
+    cmap* map = create(TOFU_INT_TYPE, shards);
+    if (map == NULL) {
+        return NULL;
+    }
+
+    for (size_t i = 0; i < keys; i++) {
+        ctofu key = { TOFU_INT_TYPE, { .int_type = (int)i } };
+        fscl_map_insert(map, key, key);
+    }
+
+    return map;
+}
+
+int main(int argc, char** argv) {
+    size_t keys = argc > 1 ? strtoul(argv[1], NULL, 10) : 1u << 20;
+    size_t ops = argc > 2 ? strtoul(argv[2], NULL, 10) : 1u << 20;
+    unsigned write_percent = argc > 3 ? (unsigned)strtoul(argv[3], NULL, 10) : 10;
+    if (keys == 0 || ops == 0 || write_percent > 100) {
+        fprintf(stderr, "usage: %s [keys] [ops-per-thread] [write-percent]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    cmap* global = bench_fill(fscl_map_create_concurrent, 1, keys);
+    cmap* striped = bench_fill(fscl_map_create_concurrent, BENCH_SHARDS, keys);
+    cmap* lockless = bench_fill(fscl_map_create_read_mostly, BENCH_SHARDS, keys);
+    if (global == NULL || striped == NULL || lockless == NULL) {
+        fprintf(stderr, "failed to create maps\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("%zu keys, %zu ops per thread, %u%% writes\n", keys, ops, write_percent);
+    printf("%8s %16s %16s %20s\n", "threads", "1 shard Mops/s", "striped Mops/s", "read-mostly Mops/s");
+    for (size_t threads = 1; threads <= BENCH_MAX_THREADS; threads *= 2) {
+        double single = bench_measure(global, threads, keys, ops, write_percent);
+        double many = bench_measure(striped, threads, keys, ops, write_percent);
+        double unlocked = bench_measure(lockless, threads, keys, ops, write_percent);
+        printf("%8zu %16.2f %16.2f %20.2f\n", threads, single * 1e-6, many * 1e-6, unlocked * 1e-6);
+    }
+
+    fscl_map_erase(global);
+    fscl_map_erase(striped);
+    fscl_map_erase(lockless);
+
+    return EXIT_SUCCESS;
+}
@@ -18,16 +18,24 @@ extern "C"
 {
 #endif
 
+#include "xstructures/hash.h"
 #include "xstructures/map.h"
+#include "xstructures/cache.h"
 #include "xstructures/queue.h"
 #include "xstructures/dqueue.h"
 #include "xstructures/pqueue.h"
 #include "xstructures/tree.h"
+#include "xstructures/btree.h"
 #include "xstructures/set.h"
 #include "xstructures/dlist.h"
 #include "xstructures/flist.h"
 #include "xstructures/stack.h"
 #include "xstructures/vector.h"
+#include "xstructures/tvector.h"
+#include "xstructures/svector.h"
+#include "xstructures/segvector.h"
+#include "xstructures/soavector.h"
+#include "xstructures/mmapvector.h"
 
 #ifdef __cplusplus
 }
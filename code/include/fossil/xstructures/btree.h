@@ -0,0 +1,265 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef fscl_btree_H
+#define fscl_btree_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "fossil/xtofu.h"
+
+// Keys held by a full node. A leaf of 16 keys and values spans eight
+// 64-byte cache lines, and scans read its keys as one contiguous array.
+#define BTREE_MAX_KEYS 16
+
+// Keys every node but the root keeps after a removal
+#define BTREE_MIN_KEYS (BTREE_MAX_KEYS / 2)
+
+// Header shared by leaf and inner nodes
+typedef struct cbtree_node {
+    size_t count;                // Number of keys
+    bool leaf;                   // Node is a cbtree_leaf, otherwise a cbtree_inner
+    ctofu keys[BTREE_MAX_KEYS];  // Keys in ascending order
+} cbtree_node;
+
+// Leaf node holding key-value pairs
+typedef struct cbtree_leaf {
+    cbtree_node node;
+    ctofu values[BTREE_MAX_KEYS];  // Value of each key
+    struct cbtree_leaf* next;      // Leaf holding the next larger keys
+} cbtree_leaf;
+
+// Inner node: keys[i] separates the keys of children[i], which are smaller,
+// from the keys of children[i + 1], which are equal or larger
+typedef struct cbtree_inner {
+    cbtree_node node;
+    cbtree_node* children[BTREE_MAX_KEYS + 1];
+} cbtree_inner;
+
+// Ordered map from keys to values
+typedef struct {
+    cbtree_node* root;   // Root node, NULL while the tree is empty
+    cbtree_leaf* first;  // Leaf holding the smallest keys
+    size_t size;         // Number of key-value pairs
+    ctofu_type tree;     // Type of the tree
+} cbtree;
+
+// Position of one pair in a tree, walking the leaves in key order. Any
+// insertion or removal invalidates the cursors of a tree.
+typedef struct {
+    const cbtree_leaf* leaf;  // Leaf of the current pair, NULL past the end
+    size_t index;             // Position of the current pair in leaf
+    ctofu end;                // Range cursors: first key past the range
+    bool bounded;             // Stop before end
+} cbtree_cursor;
+
+// =======================
+// CREATE and DELETE
+// =======================
+/**
+ * Create a new B+tree with the specified data type.
+ *
+ * @param tree The type of data the tree will store.
+ * @return     The created tree.
+ */
+cbtree* fscl_btree_create(ctofu_type tree);
+
+/**
+ * Erase the contents of the tree and free allocated memory.
+ *
+ * @param tree The tree to erase.
+ */
+void fscl_btree_erase(cbtree* tree);
+
+// =======================
+// ALGORITHM FUNCTIONS
+// =======================
+/**
+ * Insert key-value pair into the tree. Keys must have the type of the
+ * tree; every lookup rejects keys of another type with TOFU_WAS_MISMATCH
+ * or an empty result.
+ *
+ * @param tree  The tree to insert data into.
+ * @param key   The key of the data.
+ * @param value The value of the data.
+ * @return      The error code indicating the success or failure of the operation.
+ */
+ctofu_error fscl_btree_insert(cbtree* tree, ctofu key, ctofu value);
+
+/**
+ * Remove key-value pair from the tree.
+ *
+ * @param tree The tree to remove data from.
+ * @param key  The key of the data.
+ * @return     The error code indicating the success or failure of the operation.
+ */
+ctofu_error fscl_btree_remove(cbtree* tree, ctofu key);
+
+/**
+ * Search for key in the tree.
+ *
+ * @param tree The tree to search.
+ * @param key  The key to search for.
+ * @return     The error code indicating the success or failure of the operation.
+ */
+ctofu_error fscl_btree_search(const cbtree* tree, ctofu key);
+
+// =======================
+// CURSOR FUNCTIONS
+// =======================
+/**
+ * Get a cursor at the smallest key of the tree.
+ *
+ * @param tree The tree to walk.
+ * @return     The cursor, past the end if the tree is empty.
+ */
+cbtree_cursor fscl_btree_cursor_start(const cbtree* tree);
+
+/**
+ * Get a cursor at the first key not less than key.
+ *
+ * @param tree The tree to walk.
+ * @param key  The key to compare with.
+ * @return     The cursor, past the end if every key is less than key.
+ */
+cbtree_cursor fscl_btree_lower_bound(const cbtree* tree, ctofu key);
+
+/**
+ * Get a cursor at the first key greater than key.
+ *
+ * @param tree The tree to walk.
+ * @param key  The key to compare with.
+ * @return     The cursor, past the end if no key is greater than key.
+ */
+cbtree_cursor fscl_btree_upper_bound(const cbtree* tree, ctofu key);
+
+/**
+ * Get a cursor over the keys from lo up to but not including hi.
+ *
+ * @param tree The tree to walk.
+ * @param lo   The smallest key of the range.
+ * @param hi   The first key past the range.
+ * @return     The cursor, past the end if the range is empty.
+ */
+cbtree_cursor fscl_btree_range(const cbtree* tree, ctofu lo, ctofu hi);
+
+/**
+ * Check if a cursor is at a pair.
+ *
+ * @param cursor The cursor to check.
+ * @return       True if the cursor is at a pair, false past the end.
+ */
+bool fscl_btree_cursor_valid(const cbtree_cursor* cursor);
+
+/**
+ * Get the key at a cursor.
+ *
+ * @param cursor The cursor.
+ * @return       A pointer to the key, or NULL past the end.
+ */
+const ctofu* fscl_btree_cursor_key(const cbtree_cursor* cursor);
+
+/**
+ * Get the value at a cursor.
+ *
+ * @param cursor The cursor.
+ * @return       A pointer to the value, or NULL past the end.
+ */
+const ctofu* fscl_btree_cursor_value(const cbtree_cursor* cursor);
+
+/**
+ * Move a cursor to the next larger key.
+ *
+ * @param cursor The cursor to move.
+ */
+void fscl_btree_cursor_next(cbtree_cursor* cursor);
+
+// =======================
+// UTILITY FUNCTIONS
+// =======================
+/**
+ * Get the number of key-value pairs in the tree.
+ *
+ * @param tree The tree for which to get the size.
+ * @return     The number of key-value pairs.
+ */
+size_t fscl_btree_size(const cbtree* tree);
+
+/**
+ * Get the value associated with a key in the tree.
+ *
+ * @param tree  The tree from which to get the value.
+ * @param key   The key of the data.
+ * @param value Pointer to store the retrieved value.
+ * @return      The error code indicating the success or failure of the operation.
+ */
+ctofu_error fscl_btree_getter(const cbtree* tree, ctofu key, ctofu* value);
+
+/**
+ * Set the value associated with a key in the tree.
+ *
+ * @param tree  The tree in which to set the value.
+ * @param key   The key of the data.
+ * @param value The value to set.
+ * @return      The error code indicating the success or failure of the operation.
+ */
+ctofu_error fscl_btree_setter(cbtree* tree, ctofu key, ctofu value);
+
+/**
+ * Check if the tree is not empty.
+ *
+ * @param tree The tree to check.
+ * @return     True if the tree is not empty, false otherwise.
+ */
+bool fscl_btree_not_empty(const cbtree* tree);
+
+/**
+ * Check if the tree is not a null pointer.
+ *
+ * @param tree The tree to check.
+ * @return     True if the tree is not a null pointer, false otherwise.
+ */
+bool fscl_btree_not_cnullptr(const cbtree* tree);
+
+/**
+ * Check if the tree is empty.
+ *
+ * @param tree The tree to check.
+ * @return     True if the tree is empty, false otherwise.
+ */
+bool fscl_btree_is_empty(const cbtree* tree);
+
+/**
+ * Check if the tree is a null pointer.
+ *
+ * @param tree The tree to check.
+ * @return     True if the tree is a null pointer, false otherwise.
+ */
+bool fscl_btree_is_cnullptr(const cbtree* tree);
+
+/**
+ * Check if the tree contains the specified key.
+ *
+ * @param tree The tree to check.
+ * @param key  The key to search for.
+ * @return     True if the tree contains the key, false otherwise.
+ */
+bool fscl_btree_contains(const cbtree* tree, ctofu key);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,224 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef fscl_cache_H
+#define fscl_cache_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "fossil/xtofu.h"
+#include <stdint.h>
+
+// Largest number of key-value pairs a cache can hold (node links are 32-bit)
+#define CACHE_MAX_CAPACITY (UINT32_MAX / 4)
+
+// Replacement policy of a cache
+typedef enum {
+    CACHE_POLICY_LRU,    // Evict the least recently used pair
+    CACHE_POLICY_CLOCK   // Evict the first pair not used since the hand last passed it
+} ccache_policy;
+
+// Function called with each pair a full cache evicts to make room
+typedef void (*ccache_evict_fn)(const ctofu* key, const ctofu* value, void* context);
+
+// Pooled storage for one key-value pair
+typedef struct {
+    ctofu key;
+    ctofu value;
+    uint64_t hash;       // Cached hash of the key
+    uint32_t prev;       // LRU: more recently used node; free nodes: unused
+    uint32_t next;       // LRU: less recently used node; free nodes: next free node
+    bool referenced;     // CLOCK: used since the hand last passed
+} ccache_node;
+
+// Hit, miss and eviction counts of a cache
+typedef struct {
+    uint64_t hits;       // Lookups that found their key
+    uint64_t misses;     // Lookups that did not
+    uint64_t evictions;  // Pairs dropped to make room for new ones
+} ccache_stats;
+
+// Define a structure to represent a ccache
+typedef struct {
+    ccache_node* nodes;  // Node pool of capacity nodes, allocated once
+    uint32_t* slots;     // Open-addressing index holding node position plus one, 0 when empty
+    size_t slot_count;   // Number of index slots, a power of two at least twice the capacity
+    size_t size;         // Number of key-value pairs
+    size_t capacity;     // Maximum number of key-value pairs
+    ccache_policy policy; // Replacement policy
+    uint32_t head;       // LRU: most recently used node
+    uint32_t tail;       // LRU: least recently used node
+    uint32_t free_list;  // First node of the free list
+    size_t hand;         // CLOCK: next node considered for eviction
+    ccache_stats stats;  // Hit, miss and eviction counts
+    ccache_evict_fn on_evict; // Optional eviction callback
+    void* evict_context; // Pointer passed through to on_evict
+} ccache;
+
+// =======================
+// CREATE and DELETE
+// =======================
+/**
+ * Create a new cache holding at most capacity key-value pairs. All memory
+ * is allocated here, so lookups and insertions never allocate.
+ *
+ * @param list_type The type of data the cache will store.
+ * @param capacity  The maximum number of key-value pairs, at least 1.
+ * @param policy    The replacement policy used once the cache is full.
+ * @return          The created cache, or NULL if capacity is out of range.
+ */
+ccache* fscl_cache_create(ctofu_type list_type, size_t capacity, ccache_policy policy);
+
+/**
+ * Erase the contents of the cache and free allocated memory. The eviction
+ * callback is not called.
+ *
+ * @param cache The cache to erase.
+ */
+void fscl_cache_erase(ccache* cache);
+
+// =======================
+// ALGORITHM FUNCTIONS
+// =======================
+/**
+ * Get the value for a key, marking the pair as recently used and counting
+ * a hit or a miss.
+ *
+ * @param cache The cache to look in.
+ * @param key   The key to look up.
+ * @param value Pointer to store the retrieved value.
+ * @return      The error code indicating the success or failure of the operation.
+ */
+ctofu_error fscl_cache_get(ccache* cache, ctofu key, ctofu* value);
+
+/**
+ * Insert a key-value pair or replace the value of a present key, marking
+ * the pair as recently used. A full cache first evicts one pair chosen by
+ * its policy and passes it to the eviction callback.
+ *
+ * @param cache The cache to insert into.
+ * @param key   The key of the data.
+ * @param value The value of the data.
+ * @return      The error code indicating the success or failure of the operation.
+ */
+ctofu_error fscl_cache_put(ccache* cache, ctofu key, ctofu value);
+
+/**
+ * Remove a key-value pair without calling the eviction callback.
+ *
+ * @param cache The cache to remove data from.
+ * @param key   The key of the data.
+ * @return      The error code indicating the success or failure of the operation.
+ */
+ctofu_error fscl_cache_remove(ccache* cache, ctofu key);
+
+/**
+ * Remove every key-value pair without calling the eviction callback. The
+ * counters are kept.
+ *
+ * @param cache The cache to clear.
+ */
+void fscl_cache_clear(ccache* cache);
+
+// =======================
+// UTILITY FUNCTIONS
+// =======================
+/**
+ * Check if a key is present without marking it as used or counting a lookup.
+ *
+ * @param cache The cache to check.
+ * @param key   The key to check for.
+ * @return      True if the key is present, false otherwise.
+ */
+bool fscl_cache_contains(const ccache* cache, ctofu key);
+
+/**
+ * Set the function called with each pair the cache evicts. The callback
+ * runs inside fscl_cache_put and must not modify the cache.
+ *
+ * @param cache    The cache.
+ * @param on_evict The callback, or NULL for none.
+ * @param context  The pointer passed through to the callback.
+ */
+void fscl_cache_set_evict_callback(ccache* cache, ccache_evict_fn on_evict, void* context);
+
+/**
+ * Get the hit, miss and eviction counts of the cache.
+ *
+ * @param cache The cache.
+ * @return      The counts, all zero for a NULL cache.
+ */
+ccache_stats fscl_cache_stats(const ccache* cache);
+
+/**
+ * Reset the hit, miss and eviction counts of the cache to zero.
+ *
+ * @param cache The cache.
+ */
+void fscl_cache_reset_stats(ccache* cache);
+
+/**
+ * Get the number of key-value pairs in the cache.
+ *
+ * @param cache The cache.
+ * @return      The number of key-value pairs.
+ */
+size_t fscl_cache_size(const ccache* cache);
+
+/**
+ * Get the maximum number of key-value pairs the cache holds.
+ *
+ * @param cache The cache.
+ * @return      The capacity of the cache.
+ */
+size_t fscl_cache_capacity(const ccache* cache);
+
+/**
+ * Check if the cache is not empty.
+ *
+ * @param cache The cache to check.
+ * @return      True if the cache is not empty, false otherwise.
+ */
+bool fscl_cache_not_empty(const ccache* cache);
+
+/**
+ * Check if the cache is not a null pointer.
+ *
+ * @param cache The cache to check.
+ * @return      True if the cache is not a null pointer, false otherwise.
+ */
+bool fscl_cache_not_cnullptr(const ccache* cache);
+
+/**
+ * Check if the cache is empty.
+ *
+ * @param cache The cache to check.
+ * @return      True if the cache is empty, false otherwise.
+ */
+bool fscl_cache_is_empty(const ccache* cache);
+
+/**
+ * Check if the cache is a null pointer.
+ *
+ * @param cache The cache to check.
+ * @return      True if the cache is a null pointer, false otherwise.
+ */
+bool fscl_cache_is_cnullptr(const ccache* cache);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
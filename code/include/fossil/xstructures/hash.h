@@ -0,0 +1,120 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef fscl_hash_H
+#define fscl_hash_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "fossil/xtofu.h"
+#include <stdint.h>
+
+// Seed used by the containers when the caller does not provide one
+#define TOFU_HASH_SEED 0x243f6a8885a308d3ULL
+
+// A value paired with its cached hash
+typedef struct {
+    ctofu value;
+    uint64_t hash;
+} ctofu_hashed;
+
+// =======================
+// HASH FUNCTIONS
+// =======================
+/**
+ * Hash a value. Values that compare equal with fscl_tofu_compare hash to
+ * the same result for the same seed.
+ *
+ * @param value The value to hash.
+ * @param seed  The seed to mix into the hash.
+ * @return      The 64-bit hash of the value.
+ */
+uint64_t fscl_tofu_hash(const ctofu* value, uint64_t seed);
+
+/**
+ * Hash a signed integer with a single multiply-fold mixer.
+ *
+ * @param value The integer to hash.
+ * @param seed  The seed to mix into the hash.
+ * @return      The 64-bit hash of the integer.
+ */
+uint64_t fscl_tofu_hash_int(int64_t value, uint64_t seed);
+
+/**
+ * Hash an unsigned integer with a single multiply-fold mixer.
+ *
+ * @param value The integer to hash.
+ * @param seed  The seed to mix into the hash.
+ * @return      The 64-bit hash of the integer.
+ */
+uint64_t fscl_tofu_hash_uint(uint64_t value, uint64_t seed);
+
+/**
+ * Hash a floating point number. Negative and positive zero hash alike, as
+ * do all NaN payloads.
+ *
+ * @param value The number to hash.
+ * @param seed  The seed to mix into the hash.
+ * @return      The 64-bit hash of the number.
+ */
+uint64_t fscl_tofu_hash_double(double value, uint64_t seed);
+
+/**
+ * Hash a block of bytes with a wyhash-style function that consumes
+ * 48 bytes per round in three independent lanes.
+ *
+ * @param data   The bytes to hash.
+ * @param length The number of bytes to hash.
+ * @param seed   The seed to mix into the hash.
+ * @return       The 64-bit hash of the bytes.
+ */
+uint64_t fscl_tofu_hash_bytes(const void* data, size_t length, uint64_t seed);
+
+/**
+ * Hash a null-terminated string. A null pointer hashes like an empty string.
+ *
+ * @param string The string to hash.
+ * @param seed   The seed to mix into the hash.
+ * @return       The 64-bit hash of the string.
+ */
+uint64_t fscl_tofu_hash_string(const char* string, uint64_t seed);
+
+// =======================
+// CACHED HASH FUNCTIONS
+// =======================
+/**
+ * Pair a value with its hash so repeated lookups skip rehashing it.
+ *
+ * @param value The value to hash.
+ * @param seed  The seed to mix into the hash.
+ * @return      The value together with its hash.
+ */
+ctofu_hashed fscl_tofu_hashed(ctofu value, uint64_t seed);
+
+/**
+ * Check two hashed values for equality, comparing the cached hashes
+ * before falling back to fscl_tofu_compare.
+ *
+ * @param a The first hashed value.
+ * @param b The second hashed value.
+ * @return  True if the values are equal, false otherwise.
+ */
+bool fscl_tofu_hashed_equal(const ctofu_hashed* a, const ctofu_hashed* b);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -19,17 +19,63 @@ extern "C"
 #endif
 
 #include "fossil/xtofu.h"
+#include "fossil/xstructures/vector.h"
+#include <stdint.h>
 
-// Define a maximum number of key-value pairs that can be stored in the map
-#define MAX_MAP_SIZE 100
+// Smallest index allocated once the map holds its first key-value pair
+#define MAP_INITIAL_SLOTS 16
+
+// Largest number of key-value pairs a map can hold (slot entries are 32-bit)
+#define MAP_MAX_SIZE (UINT32_MAX - 2)
+
+// Open-addressing index over the dense key/value arrays of a map
+typedef struct {
+    uint64_t* slots;     // Hash fragment and entry position per slot
+    uint8_t* ctrl;       // Swiss layout: 7-bit hash tag or empty/deleted marker per slot
+    uint32_t* entries;   // Swiss layout: entry position per slot
+    const struct cmap_group* group; // Swiss layout: SIMD group matcher, NULL for linear probing
+    size_t count;        // Number of slots, always a power of two
+    size_t tombstones;   // Slots freed by removal that still break probe chains
+} cmap_index;
 
 // Define a structure to represent a cmap
 typedef struct {
-    ctofu keys[MAX_MAP_SIZE];
-    ctofu values[MAX_MAP_SIZE];
-    size_t size;
+    ctofu* keys;         // Keys, densely packed
+    ctofu* values;       // Values, parallel to keys
+    uint64_t* hashes;    // Cached hash of each key, parallel to keys
+    size_t size;         // Number of key-value pairs
+    size_t capacity;     // Allocated length of the dense arrays
+    cmap_index index;    // Hash index mapping keys to their dense position
+    cmap_index old_index; // Index still being drained by an incremental resize
+    size_t migrate_pos;  // Next slot of old_index to migrate
+    bool incremental;    // Spread index resizes across later operations
+    struct cmap_shard* shards; // Concurrent maps: independently locked shards, NULL otherwise
+    size_t shard_count;  // Number of shards, always a power of two
+    bool read_mostly;    // Concurrent maps: readers take no lock, writers copy the shard
 } cmap;
 
+// Handle to the place of one key in a map, occupied or not. A handle is
+// valid until the map is next modified through any other call; lookups in
+// between, even ones that advance an incremental resize, keep it valid.
+typedef struct {
+    cmap* map;           // Map the handle belongs to
+    ctofu key;           // Key the handle was looked up with
+    uint64_t hash;       // Hash of the key
+    size_t position;     // Dense position of the key, SIZE_MAX when vacant
+    size_t vacancy;      // Free index slot found while probing a vacant key
+} cmap_entry;
+
+// Immutable map built by fscl_map_freeze. A minimal perfect hash sends
+// every stored key to its own slot, so a lookup reads one slot and makes
+// one key comparison.
+typedef struct {
+    ctofu* pairs;            // Key of slot i at 2 * i, its value at 2 * i + 1
+    uint32_t* displacements; // Per bucket: hash seed, or slot of a single-key bucket
+    size_t size;             // Number of key-value pairs, equal to the number of slots
+    size_t bucket_count;     // Number of displacement buckets
+    uint64_t seed;           // Seed of the key hash
+} cmap_frozen;
+
 // =======================
 // CREATE and DELETE
 // =======================
@@ -41,6 +87,46 @@ typedef struct {
  */
 cmap* fscl_map_create(ctofu_type list_type);
 
+/**
+ * Create a new map whose index keeps a 7-bit hash tag per slot in a
+ * separate control-byte array. Lookups compare 16 or 32 tags per SIMD
+ * instruction, chosen for the running CPU, and only call fscl_tofu_compare
+ * on tag matches.
+ *
+ * @param list_type The type of data the map will store.
+ * @return          The created map.
+ */
+cmap* fscl_map_create_swiss(ctofu_type list_type);
+
+/**
+ * Create a map that many threads can use at once. Keys are spread by hash
+ * over independently locked shards, each behind a reader-writer lock, so
+ * lookups run in parallel and writers only wait on writers to the same
+ * shard. Calls that hand out pointers into the map (fscl_map_find,
+ * fscl_map_entry, fscl_map_get_or_insert) are not available on such a map,
+ * and its iterators see no pairs; use fscl_map_for_each instead.
+ *
+ * @param list_type The type of data the map will store.
+ * @param shards    The number of shards, rounded up to a power of two.
+ * @return          The created map, or NULL when shards is 0 or above 4096.
+ */
+cmap* fscl_map_create_concurrent(ctofu_type list_type, size_t shards);
+
+/**
+ * Create a concurrent map for data that is read far more often than it is
+ * written. Lookups take no lock and make no atomic read-modify-write: each
+ * shard publishes an immutable snapshot, and a writer copies its shard,
+ * applies the change and publishes the copy. Replaced snapshots are freed
+ * once every reader that could see them has finished. A write costs a copy
+ * of one shard, so use more shards for larger maps. Otherwise the map
+ * behaves like one from fscl_map_create_concurrent.
+ *
+ * @param list_type The type of data the map will store.
+ * @param shards    The number of shards, rounded up to a power of two.
+ * @return          The created map, or NULL when shards is 0 or above 4096.
+ */
+cmap* fscl_map_create_read_mostly(ctofu_type list_type, size_t shards);
+
 /**
  * Erase the contents of the map and free allocated memory.
  *
@@ -79,6 +165,179 @@ ctofu_error fscl_map_remove(cmap* map, ctofu key);
  */
 ctofu_error fscl_map_search(cmap* map, ctofu key);
 
+/**
+ * Look up the place of a key in one probe. The returned handle can read the
+ * value, overwrite it or fill in a missing key without probing again.
+ *
+ * @param map The map to look in.
+ * @param key The key to look up.
+ * @return    The handle for the key.
+ */
+cmap_entry fscl_map_entry(cmap* map, ctofu key);
+
+/**
+ * Check if a handle refers to a key present in the map.
+ *
+ * @param entry The handle to check.
+ * @return      True if the key is present, false otherwise.
+ */
+bool fscl_map_entry_occupied(const cmap_entry* entry);
+
+/**
+ * Get the value stored for the key of a handle.
+ *
+ * @param entry The handle to read.
+ * @return      A pointer to the stored value, or NULL if the handle is vacant.
+ */
+ctofu* fscl_map_entry_value(const cmap_entry* entry);
+
+/**
+ * Set the value for the key of a handle, inserting the key if it is vacant.
+ * The handle is occupied afterwards.
+ *
+ * @param entry The handle to write through.
+ * @param value The value to store.
+ * @return      The error code indicating the success or failure of the operation.
+ */
+ctofu_error fscl_map_entry_set(cmap_entry* entry, ctofu value);
+
+/**
+ * Insert a key-value pair, or overwrite the value if the key exists.
+ *
+ * @param map   The map to update.
+ * @param key   The key of the data.
+ * @param value The value of the data.
+ * @return      The error code indicating the success or failure of the operation.
+ */
+ctofu_error fscl_map_upsert(cmap* map, ctofu key, ctofu value);
+
+/**
+ * Get the value stored for a key, inserting the given value first if the
+ * key is missing. The pointer stays valid until the map is next modified.
+ *
+ * @param map    The map to look in.
+ * @param key    The key of the data.
+ * @param value  The value to insert when the key is missing.
+ * @param stored A pointer to receive the address of the stored value.
+ * @return       The error code indicating the success or failure of the operation.
+ */
+ctofu_error fscl_map_get_or_insert(cmap* map, ctofu key, ctofu value, ctofu** stored);
+
+// =======================
+// REFERENCE FUNCTIONS
+// =======================
+/**
+ * Find the value stored for a key without copying either of them. The map
+ * is not modified, so concurrent readers may call this under a shared lock.
+ *
+ * @param map The map to search.
+ * @param key A pointer to the key to search for.
+ * @return    A borrowed pointer to the stored value, valid until the map is
+ *            next modified, or NULL if the key is not found.
+ */
+const ctofu* fscl_map_find(const cmap* map, const ctofu* key);
+
+/**
+ * Check if the map contains a key passed by pointer. The map is not modified.
+ *
+ * @param map The map to check.
+ * @param key A pointer to the key to search for.
+ * @return    True if the map contains the key, false otherwise.
+ */
+bool fscl_map_contains_ref(const cmap* map, const ctofu* key);
+
+/**
+ * Insert a key-value pair passed by pointer into the map.
+ *
+ * @param map   The map to insert data into.
+ * @param key   A pointer to the key of the data.
+ * @param value A pointer to the value of the data.
+ * @return      The error code indicating the success or failure of the operation.
+ */
+ctofu_error fscl_map_insert_ref(cmap* map, const ctofu* key, const ctofu* value);
+
+/**
+ * Remove the key-value pair whose key is passed by pointer.
+ *
+ * @param map The map to remove data from.
+ * @param key A pointer to the key of the data.
+ * @return    The error code indicating the success or failure of the operation.
+ */
+ctofu_error fscl_map_remove_ref(cmap* map, const ctofu* key);
+
+/**
+ * Set the value for an existing key, both passed by pointer.
+ *
+ * @param map   The map in which to set the value.
+ * @param key   A pointer to the key of the data.
+ * @param value A pointer to the value to set.
+ * @return      The error code indicating the success or failure of the operation.
+ */
+ctofu_error fscl_map_setter_ref(cmap* map, const ctofu* key, const ctofu* value);
+
+/**
+ * Insert or overwrite a key-value pair passed by pointer.
+ *
+ * @param map   The map to update.
+ * @param key   A pointer to the key of the data.
+ * @param value A pointer to the value of the data.
+ * @return      The error code indicating the success or failure of the operation.
+ */
+ctofu_error fscl_map_upsert_ref(cmap* map, const ctofu* key, const ctofu* value);
+
+/**
+ * Look up the place of a key passed by pointer; see fscl_map_entry.
+ *
+ * @param map The map to look in.
+ * @param key A pointer to the key to look up.
+ * @return    The handle for the key.
+ */
+cmap_entry fscl_map_entry_ref(cmap* map, const ctofu* key);
+
+// =======================
+// BULK FUNCTIONS
+// =======================
+/**
+ * Insert n key-value pairs from parallel arrays. The map is sized once for
+ * all of them, and keys are hashed and their slots prefetched in batches
+ * so the cache misses of a batch overlap. A key already in the map, or
+ * repeated within keys, keeps its first value.
+ *
+ * @param map    The map to insert data into.
+ * @param keys   The keys of the data.
+ * @param values The values of the data, parallel to keys.
+ * @param n      The number of pairs.
+ * @return       TOFU_SUCCESS, TOFU_WAS_MISMATCH if duplicate keys were
+ *               skipped, or the error that stopped the insertion.
+ */
+ctofu_error fscl_map_insert_many(cmap* map, const ctofu* keys, const ctofu* values, size_t n);
+
+/**
+ * Look up n keys at once. Keys are hashed and their slots prefetched in
+ * batches before any of them is resolved, so the cache misses of a batch
+ * overlap. Concurrent maps pin each shard once for all of its keys.
+ *
+ * @param map        The map to search in.
+ * @param keys       The keys to look up.
+ * @param n          The number of keys.
+ * @param out_values Receives the value of each key found, parallel to keys.
+ *                   Positions of missing keys are left untouched.
+ * @param out_found  Receives whether each key was found, or NULL.
+ * @return           TOFU_SUCCESS if every key was found, TOFU_NOT_FOUND if
+ *                   any was missing, or the error that stopped the lookup.
+ */
+ctofu_error fscl_map_get_many(cmap* map, const ctofu* keys, size_t n, ctofu* out_values, bool* out_found);
+
+/**
+ * Create a map from a vector of keys and a vector of values of the same
+ * size, pairing elements by position. Repeated keys keep their first value.
+ *
+ * @param keys   The keys of the data.
+ * @param values The values of the data.
+ * @return       The created map, or NULL if the sizes differ or on failure.
+ */
+cmap* fscl_map_from_vectors(const cvector* keys, const cvector* values);
+
 // =======================
 // UTILITY FUNCTIONS
 // =======================
@@ -110,6 +369,21 @@ ctofu_error fscl_map_getter(cmap* map, ctofu key, ctofu* value);
  */
 ctofu_error fscl_map_setter(cmap* map, ctofu key, ctofu value);
 
+/**
+ * Enable or disable incremental resizing. When enabled, growing the index
+ * keeps the old one alive and every insert, remove and lookup migrates a
+ * bounded number of its slots, so no single call pays for a full rehash.
+ * Only the index is spread out: the dense key and value arrays still grow
+ * by doubling, so an insert that fills them copies every pair and
+ * invalidates iterators, as it does without incremental resizing.
+ * Disabling it finishes any migration in progress.
+ *
+ * @param map         The map to configure.
+ * @param incremental True to resize incrementally, false to resize at once.
+ * @return            The error code indicating the success or failure of the operation.
+ */
+ctofu_error fscl_map_set_incremental(cmap* map, bool incremental);
+
 /**
  * Check if the map is not empty.
  *
@@ -151,6 +425,18 @@ bool fscl_map_is_cnullptr(cmap* map);
  */
 bool fscl_map_contains(cmap* map, ctofu key);
 
+/**
+ * Call visit on every key-value pair until it returns false. On a
+ * concurrent map each shard is read-locked while its pairs are visited,
+ * so visit must not modify the map.
+ *
+ * @param map     The map to walk.
+ * @param visit   The function called with each key, value and context.
+ * @param context The pointer passed through to visit.
+ * @return        The error code indicating the success or failure of the operation.
+ */
+ctofu_error fscl_map_for_each(cmap* map, bool (*visit)(const ctofu* key, const ctofu* value, void* context), void* context);
+
 // =======================
 // ITERATOR FUNCTIONS
 // =======================
@@ -179,13 +465,70 @@ ctofu_iterator fscl_map_iterator_end(cmap* map);
 ctofu_iterator fscl_map_iterator_next(ctofu_iterator iterator);
 
 /**
- * Check if there is a next iterator in the sequence.
+ * Check if there is a next iterator in the sequence. The map marks the
+ * slot after its last pair, so the iterator needs no reference to it.
  *
  * @param iterator The current iterator.
  * @return         True if there is a next iterator, false otherwise.
  */
 bool fscl_map_iterator_has_next(ctofu_iterator iterator);
 
+// =======================
+// FROZEN FUNCTIONS
+// =======================
+/**
+ * Build an immutable copy of the map with a minimal perfect hash, in time
+ * linear in its size. The map is left unchanged and may be erased after.
+ *
+ * @param map The map to copy.
+ * @return    The frozen map, or NULL on allocation failure or when the map
+ *            holds two keys with the same 64-bit hash under every seed tried.
+ */
+cmap_frozen* fscl_map_freeze(cmap* map);
+
+/**
+ * Erase a frozen map and free allocated memory.
+ *
+ * @param frozen The frozen map to erase.
+ */
+void fscl_map_frozen_erase(cmap_frozen* frozen);
+
+/**
+ * Find the value stored for a key in a frozen map.
+ *
+ * @param frozen The frozen map to look in.
+ * @param key    The key to look up.
+ * @return       A pointer to the stored value, or NULL if the key is not present.
+ */
+const ctofu* fscl_map_frozen_find(const cmap_frozen* frozen, const ctofu* key);
+
+/**
+ * Get the value for a key in a frozen map.
+ *
+ * @param frozen The frozen map to look in.
+ * @param key    The key to look up.
+ * @param value  Pointer to store the retrieved value.
+ * @return       The error code indicating the success or failure of the operation.
+ */
+ctofu_error fscl_map_frozen_getter(const cmap_frozen* frozen, ctofu key, ctofu* value);
+
+/**
+ * Check if a frozen map contains a key.
+ *
+ * @param frozen The frozen map to check.
+ * @param key    The key to check for.
+ * @return       True if the key is present, false otherwise.
+ */
+bool fscl_map_frozen_contains(const cmap_frozen* frozen, ctofu key);
+
+/**
+ * Get the number of key-value pairs in a frozen map.
+ *
+ * @param frozen The frozen map.
+ * @return       The number of key-value pairs.
+ */
+size_t fscl_map_frozen_size(const cmap_frozen* frozen);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,220 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef fscl_mmapvector_H
+#define fscl_mmapvector_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "fossil/xstructures/vector.h"
+#include <stdint.h>
+
+// How a file-backed vector opens its file
+typedef enum {
+    VECTOR_MMAP_READ,     // Map an existing vector file read-only
+    VECTOR_MMAP_WRITE,    // Map a vector file read-write, creating it if missing
+    VECTOR_MMAP_CREATE    // Map a new, empty vector file, replacing any old one
+} cvector_mmap_mode;
+
+// Access pattern hints for the pages of a file-backed vector
+typedef enum {
+    VECTOR_MMAP_NORMAL,
+    VECTOR_MMAP_SEQUENTIAL,  // Read ahead aggressively, drop pages behind
+    VECTOR_MMAP_RANDOM,      // Do not read ahead
+    VECTOR_MMAP_WILLNEED,    // Start reading every page in now
+    VECTOR_MMAP_HUGEPAGE     // Back the mapping with huge pages where supported
+} cvector_mmap_advice;
+
+// A vector of ctofu elements stored in a memory-mapped file. The file
+// holds a small header with the expected type and size, followed by the
+// payloads packed at the natural width of the type, as in cvector_soa.
+// Opening is instant whatever the size of the file: pages are read on
+// first access and shared with every other process mapping the file.
+// Only types whose payloads are plain values can be stored, so string
+// and array vectors are rejected.
+typedef struct {
+    unsigned char* map;       // The mapped file, header first
+    size_t map_length;        // Bytes mapped, the length of the file
+    size_t width;             // Bytes of payload per element
+    size_t size;
+    size_t capacity;          // Payloads the file has room for
+    ctofu_type expected_type;
+    cvector_mmap_mode mode;
+    intptr_t file;            // File descriptor, or file HANDLE on Windows
+    intptr_t mapping;         // File mapping HANDLE on Windows
+} cvector_mmap;
+
+// =======================
+// CREATE and DELETE
+// =======================
+
+/**
+ * Open a vector file and map it into memory.
+ *
+ * @param vector        The vector to open.
+ * @param path          The path of the vector file.
+ * @param expected_type The expected type of elements in the vector.
+ * @param mode          How to open the file.
+ * @return              TOFU_SUCCESS, TOFU_WAS_NULLPTR, TOFU_NOT_FOUND when
+ *                      the file cannot be opened, TOFU_WAS_MISMATCH when it
+ *                      is not a vector file of the expected type or the
+ *                      type cannot be stored in a file, or
+ *                      TOFU_WAS_BAD_MALLOC when it cannot be sized or mapped.
+ */
+ctofu_error fscl_vector_mmap_open(cvector_mmap* vector, const char* path, ctofu_type expected_type, cvector_mmap_mode mode);
+
+/**
+ * Unmap the vector and close its file. A writable file is first cut down
+ * to the elements it holds, dropping the room reserved for growth.
+ *
+ * @param vector The vector to close.
+ */
+void fscl_vector_mmap_close(cvector_mmap* vector);
+
+/**
+ * Write the modified pages of a writable vector back to its file and wait
+ * for them to reach the disk.
+ *
+ * @param vector The vector to sync.
+ * @return       TOFU_SUCCESS, TOFU_WAS_NULLPTR, or TOFU_WAS_BAD_MALLOC
+ *               when the write fails.
+ */
+ctofu_error fscl_vector_mmap_sync(cvector_mmap* vector);
+
+/**
+ * Tell the operating system how the vector will be accessed. Hints the
+ * platform lacks are ignored.
+ *
+ * @param vector The vector to advise on.
+ * @param advice The expected access pattern.
+ * @return       TOFU_SUCCESS, or TOFU_WAS_NULLPTR.
+ */
+ctofu_error fscl_vector_mmap_advise(cvector_mmap* vector, cvector_mmap_advice advice);
+
+/**
+ * Append every element of a cvector of the same expected type.
+ *
+ * @param vector The vector to which the elements will be added.
+ * @param source The cvector whose elements to add.
+ * @return       TOFU_SUCCESS, TOFU_WAS_NULLPTR, TOFU_WAS_MISMATCH when the
+ *               types differ or the vector is read-only, or
+ *               TOFU_WAS_BAD_MALLOC when the file cannot grow.
+ */
+ctofu_error fscl_vector_mmap_extend(cvector_mmap* vector, const cvector* source);
+
+// =======================
+// ALGORITHM FUNCTIONS
+// =======================
+
+/**
+ * Add an element to the end of the vector. Growing the file remaps it,
+ * which may move the payloads.
+ *
+ * @param vector  The vector to which the element will be added.
+ * @param element The element to add.
+ * @return        TOFU_SUCCESS, TOFU_WAS_MISMATCH for an element of the
+ *                wrong type or a read-only vector, or TOFU_WAS_BAD_MALLOC
+ *                when the file cannot grow.
+ */
+ctofu_error fscl_vector_mmap_push_back(cvector_mmap* vector, ctofu element);
+
+/**
+ * Search for a target element in the vector. Floating-point payloads
+ * compare with ==, so NaN matches nothing.
+ *
+ * @param vector The vector to search.
+ * @param target The element to search for.
+ * @return       The index of the target element, or -1 if not found or
+ *               if its index does not fit in an int; use
+ *               fscl_vector_mmap_find_all for files that large.
+ */
+int fscl_vector_mmap_search(const cvector_mmap* vector, ctofu target);
+
+/**
+ * Find every element equal to target, in order.
+ *
+ * @param vector   The vector to search.
+ * @param target   The element to search for.
+ * @param indexes  Where to store the indexes of the matches.
+ * @param capacity How many indexes fit in indexes.
+ * @return         The number of matches, which may exceed capacity.
+ */
+size_t fscl_vector_mmap_find_all(const cvector_mmap* vector, ctofu target, size_t* indexes, size_t capacity);
+
+// =======================
+// UTILITY FUNCTIONS
+// =======================
+
+/**
+ * Get the payload column. Element i starts at byte i * width and is the
+ * member of ctofu_data matching the expected type. The pointer is valid
+ * until the vector next grows or is closed.
+ *
+ * @param vector The vector whose payloads to get.
+ * @return       The first payload, or NULL if the vector is not open.
+ */
+const void* fscl_vector_mmap_payloads(const cvector_mmap* vector);
+
+/**
+ * Set the element at the specified index in the vector.
+ *
+ * @param vector  The vector in which to set the element.
+ * @param index   The index at which to set the element.
+ * @param element The element to set.
+ * @return        TOFU_SUCCESS, TOFU_WAS_BAD_RANGE past the end, or
+ *                TOFU_WAS_MISMATCH for an element of the wrong type or a
+ *                read-only vector.
+ */
+ctofu_error fscl_vector_mmap_setter(cvector_mmap* vector, size_t index, ctofu element);
+
+/**
+ * Get the element at the specified index in the vector.
+ *
+ * @param vector The vector from which to get the element.
+ * @param index  The index from which to get the element.
+ * @return       The element at the specified index, or an element of
+ *               TOFU_INVALID_TYPE past the end.
+ */
+ctofu fscl_vector_mmap_getter(const cvector_mmap* vector, size_t index);
+
+/**
+ * Get the size of the vector.
+ *
+ * @param vector The vector for which to get the size.
+ * @return       The size of the vector.
+ */
+size_t fscl_vector_mmap_size(const cvector_mmap* vector);
+
+/**
+ * Check if the vector is empty.
+ *
+ * @param vector The vector to check.
+ * @return       True if the vector is empty, false otherwise.
+ */
+bool fscl_vector_mmap_is_empty(const cvector_mmap* vector);
+
+/**
+ * Check if the vector is not empty.
+ *
+ * @param vector The vector to check.
+ * @return       True if the vector is not empty, false otherwise.
+ */
+bool fscl_vector_mmap_not_empty(const cvector_mmap* vector);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
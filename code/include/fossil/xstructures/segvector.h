@@ -0,0 +1,173 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef fscl_segvector_H
+#define fscl_segvector_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "fossil/xstructures/vector.h"
+#include <limits.h>
+
+// The first chunk holds 1 << VECTOR_SEGMENT_SHIFT elements and every
+// further chunk twice as many as the one before it
+#define VECTOR_SEGMENT_SHIFT 4
+
+// Number of chunks needed to address every index a size_t can hold
+#define VECTOR_SEGMENT_CHUNKS (sizeof(size_t) * CHAR_BIT - VECTOR_SEGMENT_SHIFT)
+
+// A vector of ctofu elements stored in a directory of geometrically sized
+// chunks. Growing allocates one more chunk and never moves the elements
+// already stored, so pointers from fscl_vector_segmented_at stay valid
+// until the vector is erased, and no push copies the existing elements.
+typedef struct {
+    ctofu* chunks[VECTOR_SEGMENT_CHUNKS]; // Chunk k holds 1 << (VECTOR_SEGMENT_SHIFT + k) elements
+    size_t chunk_count;                   // Number of chunks allocated
+    size_t size;
+    ctofu_type expected_type;
+} cvector_segmented;
+
+// =======================
+// CREATE and DELETE
+// =======================
+
+/**
+ * Create a new segmented vector with the specified expected type. No
+ * chunk is allocated until the first push.
+ *
+ * @param expected_type The expected type of elements in the vector.
+ * @return              The created vector.
+ */
+cvector_segmented fscl_vector_segmented_create(ctofu_type expected_type);
+
+/**
+ * Erase the contents of the vector, freeing every chunk.
+ *
+ * @param vector The vector to erase.
+ */
+void fscl_vector_segmented_erase(cvector_segmented* vector);
+
+// =======================
+// ALGORITHM FUNCTIONS
+// =======================
+
+/**
+ * Add an element to the end of the vector, allocating a new chunk when
+ * the last one is full.
+ *
+ * @param vector  The vector to which the element will be added.
+ * @param element The element to add.
+ * @return        TOFU_SUCCESS, TOFU_WAS_MISMATCH for an element of the
+ *                wrong type, or TOFU_WAS_BAD_MALLOC.
+ */
+ctofu_error fscl_vector_segmented_push_back(cvector_segmented* vector, ctofu element);
+
+/**
+ * Search for a target element in the vector.
+ *
+ * @param vector The vector to search.
+ * @param target The element to search for.
+ * @return       The index of the target element, or -1 if not found.
+ */
+int fscl_vector_segmented_search(const cvector_segmented* vector, ctofu target);
+
+// =======================
+// UTILITY FUNCTIONS
+// =======================
+
+/**
+ * Get a pointer to the element at the specified index. The pointer stays
+ * valid while elements are pushed, until the vector is erased.
+ *
+ * @param vector The vector from which to get the element.
+ * @param index  The index of the element.
+ * @return       A pointer to the element, or NULL past the end.
+ */
+ctofu* fscl_vector_segmented_at(cvector_segmented* vector, size_t index);
+
+/**
+ * Set the element at the specified index in the vector.
+ *
+ * @param vector  The vector in which to set the element.
+ * @param index   The index at which to set the element.
+ * @param element The element to set.
+ * @return        TOFU_SUCCESS, TOFU_WAS_BAD_RANGE past the end, or
+ *                TOFU_WAS_MISMATCH for an element of the wrong type.
+ */
+ctofu_error fscl_vector_segmented_setter(cvector_segmented* vector, size_t index, ctofu element);
+
+/**
+ * Get the element at the specified index in the vector.
+ *
+ * @param vector The vector from which to get the element.
+ * @param index  The index from which to get the element.
+ * @return       The element at the specified index, or an element of
+ *               TOFU_INVALID_TYPE past the end.
+ */
+ctofu fscl_vector_segmented_getter(const cvector_segmented* vector, size_t index);
+
+/**
+ * Get the size of the vector.
+ *
+ * @param vector The vector for which to get the size.
+ * @return       The size of the vector.
+ */
+size_t fscl_vector_segmented_size(const cvector_segmented* vector);
+
+/**
+ * Get the number of elements the allocated chunks can hold.
+ *
+ * @param vector The vector for which to get the capacity.
+ * @return       The capacity of the vector.
+ */
+size_t fscl_vector_segmented_capacity(const cvector_segmented* vector);
+
+/**
+ * Check if the vector is a null pointer.
+ *
+ * @param vector The vector to check.
+ * @return       True if the vector is a null pointer, false otherwise.
+ */
+bool fscl_vector_segmented_is_cnullptr(const cvector_segmented* vector);
+
+/**
+ * Check if the vector is not a null pointer.
+ *
+ * @param vector The vector to check.
+ * @return       True if the vector is not a null pointer, false otherwise.
+ */
+bool fscl_vector_segmented_not_cnullptr(const cvector_segmented* vector);
+
+/**
+ * Check if the vector is empty.
+ *
+ * @param vector The vector to check.
+ * @return       True if the vector is empty, false otherwise.
+ */
+bool fscl_vector_segmented_is_empty(const cvector_segmented* vector);
+
+/**
+ * Check if the vector is not empty.
+ *
+ * @param vector The vector to check.
+ * @return       True if the vector is not empty, false otherwise.
+ */
+bool fscl_vector_segmented_not_empty(const cvector_segmented* vector);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,181 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef fscl_soavector_H
+#define fscl_soavector_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "fossil/xstructures/vector.h"
+
+// A vector of ctofu elements stored as a structure of arrays. Elements all
+// have the expected type, so the tag is stored once for the whole vector,
+// and the payloads are packed into one column at the natural width of that
+// type: 4 bytes per int, 8 per double or string, 1 per char. Scans touch
+// only payload bytes, and integer and floating-point searches run the SIMD
+// kernels on the column directly.
+typedef struct {
+    unsigned char* payloads;  // size payloads of width bytes each
+    size_t width;             // Bytes of payload per element
+    size_t size;
+    size_t capacity;
+    ctofu_type expected_type; // The tag shared by every element
+} cvector_soa;
+
+// =======================
+// CREATE and DELETE
+// =======================
+
+/**
+ * Create a new structure-of-arrays vector with the specified expected
+ * type. Nothing is allocated until the first push.
+ *
+ * @param expected_type The expected type of elements in the vector.
+ * @return              The created vector.
+ */
+cvector_soa fscl_vector_soa_create(ctofu_type expected_type);
+
+/**
+ * Erase the contents of the vector, freeing the payload column.
+ *
+ * @param vector The vector to erase.
+ */
+void fscl_vector_soa_erase(cvector_soa* vector);
+
+/**
+ * Append every element of a cvector of the same expected type.
+ *
+ * @param vector The vector to which the elements will be added.
+ * @param source The cvector whose elements to add.
+ * @return       TOFU_SUCCESS, TOFU_WAS_NULLPTR, TOFU_WAS_MISMATCH when the
+ *               expected types differ, or TOFU_WAS_BAD_MALLOC.
+ */
+ctofu_error fscl_vector_soa_extend(cvector_soa* vector, const cvector* source);
+
+// =======================
+// ALGORITHM FUNCTIONS
+// =======================
+
+/**
+ * Add an element to the end of the vector.
+ *
+ * @param vector  The vector to which the element will be added.
+ * @param element The element to add.
+ * @return        TOFU_SUCCESS, TOFU_WAS_MISMATCH for an element of the
+ *                wrong type, or TOFU_WAS_BAD_MALLOC.
+ */
+ctofu_error fscl_vector_soa_push_back(cvector_soa* vector, ctofu element);
+
+/**
+ * Search for a target element in the vector. Floating-point payloads
+ * compare with ==, so NaN matches nothing.
+ *
+ * @param vector The vector to search.
+ * @param target The element to search for.
+ * @return       The index of the target element, or -1 if not found.
+ */
+int fscl_vector_soa_search(const cvector_soa* vector, ctofu target);
+
+/**
+ * Find every element equal to target, in order.
+ *
+ * @param vector   The vector to search.
+ * @param target   The element to search for.
+ * @param indexes  Where to store the indexes of the matches.
+ * @param capacity How many indexes fit in indexes.
+ * @return         The number of matches, which may exceed capacity.
+ */
+size_t fscl_vector_soa_find_all(const cvector_soa* vector, ctofu target, size_t* indexes, size_t capacity);
+
+// =======================
+// UTILITY FUNCTIONS
+// =======================
+
+/**
+ * Get the payload column. Element i starts at byte i * width and is the
+ * member of ctofu_data matching the expected type. The pointer is valid
+ * until the vector is next modified.
+ *
+ * @param vector The vector whose payloads to get.
+ * @return       The first payload, or NULL if there is none.
+ */
+const void* fscl_vector_soa_payloads(const cvector_soa* vector);
+
+/**
+ * Set the element at the specified index in the vector.
+ *
+ * @param vector  The vector in which to set the element.
+ * @param index   The index at which to set the element.
+ * @param element The element to set.
+ * @return        TOFU_SUCCESS, TOFU_WAS_BAD_RANGE past the end, or
+ *                TOFU_WAS_MISMATCH for an element of the wrong type.
+ */
+ctofu_error fscl_vector_soa_setter(cvector_soa* vector, size_t index, ctofu element);
+
+/**
+ * Get the element at the specified index in the vector.
+ *
+ * @param vector The vector from which to get the element.
+ * @param index  The index from which to get the element.
+ * @return       The element at the specified index, or an element of
+ *               TOFU_INVALID_TYPE past the end.
+ */
+ctofu fscl_vector_soa_getter(const cvector_soa* vector, size_t index);
+
+/**
+ * Get the size of the vector.
+ *
+ * @param vector The vector for which to get the size.
+ * @return       The size of the vector.
+ */
+size_t fscl_vector_soa_size(const cvector_soa* vector);
+
+/**
+ * Check if the vector is a null pointer.
+ *
+ * @param vector The vector to check.
+ * @return       True if the vector is a null pointer, false otherwise.
+ */
+bool fscl_vector_soa_is_cnullptr(const cvector_soa* vector);
+
+/**
+ * Check if the vector is not a null pointer.
+ *
+ * @param vector The vector to check.
+ * @return       True if the vector is not a null pointer, false otherwise.
+ */
+bool fscl_vector_soa_not_cnullptr(const cvector_soa* vector);
+
+/**
+ * Check if the vector is empty.
+ *
+ * @param vector The vector to check.
+ * @return       True if the vector is empty, false otherwise.
+ */
+bool fscl_vector_soa_is_empty(const cvector_soa* vector);
+
+/**
+ * Check if the vector is not empty.
+ *
+ * @param vector The vector to check.
+ * @return       True if the vector is not empty, false otherwise.
+ */
+bool fscl_vector_soa_not_empty(const cvector_soa* vector);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,177 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef fscl_svector_H
+#define fscl_svector_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "fossil/xstructures/vector.h"
+
+// Number of elements a small vector holds before it spills to the heap
+#define VECTOR_SMALL_INLINE 4
+
+// A vector of ctofu elements whose first VECTOR_SMALL_INLINE elements live
+// inside the structure itself, so short vectors never allocate. Past that
+// it moves its elements to the heap and grows like a cvector. The
+// structure holds no pointer into itself, so it may be copied or returned
+// by value while it is inline.
+typedef struct {
+    ctofu* heap;             // Heap storage once spilled, NULL while inline
+    size_t size;
+    size_t capacity;         // VECTOR_SMALL_INLINE while inline
+    ctofu_type expected_type;
+    ctofu inline_data[VECTOR_SMALL_INLINE];
+} cvector_small;
+
+// =======================
+// CREATE and DELETE
+// =======================
+
+/**
+ * Create a new small vector with the specified expected type. Nothing is
+ * allocated.
+ *
+ * @param expected_type The expected type of elements in the vector.
+ * @return              The created vector.
+ */
+cvector_small fscl_vector_small_create(ctofu_type expected_type);
+
+/**
+ * Erase the contents of the vector, freeing any heap storage, and return
+ * it to inline storage.
+ *
+ * @param vector The vector to erase.
+ */
+void fscl_vector_small_erase(cvector_small* vector);
+
+// =======================
+// ALGORITHM FUNCTIONS
+// =======================
+
+/**
+ * Add an element to the end of the vector, spilling to the heap once the
+ * inline storage is full.
+ *
+ * @param vector  The vector to which the element will be added.
+ * @param element The element to add.
+ * @return        TOFU_SUCCESS, TOFU_WAS_MISMATCH for an element of the
+ *                wrong type, or TOFU_WAS_BAD_MALLOC.
+ */
+ctofu_error fscl_vector_small_push_back(cvector_small* vector, ctofu element);
+
+/**
+ * Search for a target element in the vector.
+ *
+ * @param vector The vector to search.
+ * @param target The element to search for.
+ * @return       The index of the target element, or -1 if not found.
+ */
+int fscl_vector_small_search(const cvector_small* vector, ctofu target);
+
+/**
+ * Reverse the order of elements in the vector.
+ *
+ * @param vector The vector to reverse.
+ */
+void fscl_vector_small_reverse(cvector_small* vector);
+
+// =======================
+// UTILITY FUNCTIONS
+// =======================
+
+/**
+ * Get the elements of the vector, wherever they are stored. The pointer is
+ * valid until the vector is next modified or moved.
+ *
+ * @param vector The vector whose elements to get.
+ * @return       The first element, or NULL if vector is NULL.
+ */
+ctofu* fscl_vector_small_data(cvector_small* vector);
+
+/**
+ * Check whether the elements are still stored inside the vector.
+ *
+ * @param vector The vector to check.
+ * @return       True if the vector has not spilled to the heap.
+ */
+bool fscl_vector_small_is_inline(const cvector_small* vector);
+
+/**
+ * Set the element at the specified index in the vector.
+ *
+ * @param vector  The vector in which to set the element.
+ * @param index   The index at which to set the element.
+ * @param element The element to set.
+ * @return        TOFU_SUCCESS, TOFU_WAS_BAD_RANGE past the end, or
+ *                TOFU_WAS_MISMATCH for an element of the wrong type.
+ */
+ctofu_error fscl_vector_small_setter(cvector_small* vector, size_t index, ctofu element);
+
+/**
+ * Get the element at the specified index in the vector.
+ *
+ * @param vector The vector from which to get the element.
+ * @param index  The index from which to get the element.
+ * @return       The element at the specified index, or an element of
+ *               TOFU_INVALID_TYPE past the end.
+ */
+ctofu fscl_vector_small_getter(const cvector_small* vector, size_t index);
+
+/**
+ * Get the size of the vector.
+ *
+ * @param vector The vector for which to get the size.
+ * @return       The size of the vector.
+ */
+size_t fscl_vector_small_size(const cvector_small* vector);
+
+/**
+ * Check if the vector is a null pointer.
+ *
+ * @param vector The vector to check.
+ * @return       True if the vector is a null pointer, false otherwise.
+ */
+bool fscl_vector_small_is_cnullptr(const cvector_small* vector);
+
+/**
+ * Check if the vector is not a null pointer.
+ *
+ * @param vector The vector to check.
+ * @return       True if the vector is not a null pointer, false otherwise.
+ */
+bool fscl_vector_small_not_cnullptr(const cvector_small* vector);
+
+/**
+ * Check if the vector is empty.
+ *
+ * @param vector The vector to check.
+ * @return       True if the vector is empty, false otherwise.
+ */
+bool fscl_vector_small_is_empty(const cvector_small* vector);
+
+/**
+ * Check if the vector is not empty.
+ *
+ * @param vector The vector to check.
+ * @return       True if the vector is not empty, false otherwise.
+ */
+bool fscl_vector_small_not_empty(const cvector_small* vector);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -20,11 +20,15 @@ extern "C"
 
 #include "fossil/xtofu.h"
 
-// Node structure for the binary search tree
+// Node structure for the binary search tree. The tree is kept AVL
+// balanced, so the heights of the two subtrees of a node never differ by
+// more than one and every operation is O(log n) whatever the insertion
+// order.
 typedef struct ctree_node {
     ctofu data;
     struct ctree_node* left;
     struct ctree_node* right;
+    int height; // Height of the subtree rooted here, 1 for a leaf
 } ctree_node;
 
 // Tree structure
@@ -0,0 +1,222 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef fscl_tvector_H
+#define fscl_tvector_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "fossil/xtofu.h"
+#include <stdint.h>
+#include <stdlib.h>
+
+// Capacity of a typed vector after its first push
+#define FSCL_VECTOR_TYPED_INITIAL_CAPACITY 16
+
+// Typed vectors store raw elements of one C type contiguously, with no
+// per-element type tag, so they take a fraction of the memory of a cvector
+// and loops over their data can be vectorized by the compiler. Every
+// typed vector is generated from the same template:
+//
+//   FSCL_VECTOR_TYPED_DECLARE(name, type) declares cvector_<name> and its
+//   functions, FSCL_VECTOR_TYPED_DEFINE(name, type) defines the functions
+//   in exactly one source file. DEFINE is DEFINE_BASE plus DEFINE_SEARCH,
+//   so an instance can supply its own search and find_all instead.
+//
+// The library instantiates i32, i64, u64, f32, f64 and ptr, with SIMD
+// searches for the numeric ones; other element types can be instantiated
+// the same way. Each instance provides:
+//
+//   cvector_<name> fscl_vector_<name>_create(void)
+//       Create an empty vector. Nothing is allocated until the first push.
+//   void fscl_vector_<name>_erase(cvector_<name>* vector)
+//       Free the elements and leave the vector empty.
+//   ctofu_error fscl_vector_<name>_push_back(cvector_<name>* vector, type element)
+//       Append an element, doubling the capacity when full.
+//   int fscl_vector_<name>_search(const cvector_<name>* vector, type target)
+//       Get the index of the first element equal (==) to target, or -1.
+//   size_t fscl_vector_<name>_find_all(const cvector_<name>* vector, type target, size_t* indexes, size_t capacity)
+//       Store the indexes of up to capacity elements equal to target and
+//       return the number of matches, which may exceed capacity.
+//   void fscl_vector_<name>_reverse(cvector_<name>* vector)
+//       Reverse the order of the elements.
+//   ctofu_error fscl_vector_<name>_setter(cvector_<name>* vector, size_t index, type element)
+//   ctofu_error fscl_vector_<name>_getter(const cvector_<name>* vector, size_t index, type* element)
+//       Set or get the element at index, TOFU_WAS_BAD_RANGE past the end.
+//   size_t fscl_vector_<name>_size(const cvector_<name>* vector)
+//   bool fscl_vector_<name>_is_cnullptr / _not_cnullptr / _is_empty / _not_empty
+//       Same meaning as for cvector.
+//
+// The data field may be read and written directly for indexes below size.
+
+#define FSCL_VECTOR_TYPED_DECLARE(name, type)                                              \
+    typedef struct {                                                                       \
+        type* data;                                                                        \
+        size_t size;                                                                       \
+        size_t capacity;                                                                   \
+    } cvector_##name;                                                                      \
+                                                                                           \
+    cvector_##name fscl_vector_##name##_create(void);                                      \
+    void fscl_vector_##name##_erase(cvector_##name* vector);                               \
+    ctofu_error fscl_vector_##name##_push_back(cvector_##name* vector, type element);      \
+    int fscl_vector_##name##_search(const cvector_##name* vector, type target);            \
+    size_t fscl_vector_##name##_find_all(const cvector_##name* vector, type target, size_t* indexes, size_t capacity); \
+    void fscl_vector_##name##_reverse(cvector_##name* vector);                             \
+    ctofu_error fscl_vector_##name##_setter(cvector_##name* vector, size_t index, type element); \
+    ctofu_error fscl_vector_##name##_getter(const cvector_##name* vector, size_t index, type* element); \
+    size_t fscl_vector_##name##_size(const cvector_##name* vector);                        \
+    bool fscl_vector_##name##_is_cnullptr(const cvector_##name* vector);                   \
+    bool fscl_vector_##name##_not_cnullptr(const cvector_##name* vector);                  \
+    bool fscl_vector_##name##_is_empty(const cvector_##name* vector);                      \
+    bool fscl_vector_##name##_not_empty(const cvector_##name* vector);
+
+#define FSCL_VECTOR_TYPED_DEFINE(name, type)                                               \
+    FSCL_VECTOR_TYPED_DEFINE_BASE(name, type)                                              \
+    FSCL_VECTOR_TYPED_DEFINE_SEARCH(name, type)
+
+#define FSCL_VECTOR_TYPED_DEFINE_SEARCH(name, type)                                        \
+    int fscl_vector_##name##_search(const cvector_##name* vector, type target) {           \
+        if (vector == NULL) {                                                              \
+            return -1;                                                                     \
+        }                                                                                  \
+        for (size_t i = 0; i < vector->size; ++i) {                                        \
+            if (vector->data[i] == target) {                                               \
+                return (int)i;                                                             \
+            }                                                                              \
+        }                                                                                  \
+        return -1;                                                                         \
+    }                                                                                      \
+                                                                                           \
+    size_t fscl_vector_##name##_find_all(const cvector_##name* vector, type target, size_t* indexes, size_t capacity) { \
+        if (vector == NULL || (indexes == NULL && capacity > 0)) {                         \
+            return 0;                                                                      \
+        }                                                                                  \
+        size_t count = 0;                                                                  \
+        for (size_t i = 0; i < vector->size; ++i) {                                        \
+            if (vector->data[i] == target) {                                               \
+                if (count < capacity) {                                                    \
+                    indexes[count] = i;                                                    \
+                }                                                                          \
+                count++;                                                                   \
+            }                                                                              \
+        }                                                                                  \
+        return count;                                                                      \
+    }
+
+#define FSCL_VECTOR_TYPED_DEFINE_BASE(name, type)                                          \
+    cvector_##name fscl_vector_##name##_create(void) {                                     \
+        cvector_##name new_vector = { NULL, 0, 0 };                                        \
+        return new_vector;                                                                 \
+    }                                                                                      \
+                                                                                           \
+    void fscl_vector_##name##_erase(cvector_##name* vector) {                              \
+        if (vector == NULL) {                                                              \
+            return;                                                                        \
+        }                                                                                  \
+        free(vector->data);                                                                \
+        vector->data = NULL;                                                               \
+        vector->size = 0;                                                                  \
+        vector->capacity = 0;                                                              \
+    }                                                                                      \
+                                                                                           \
+    ctofu_error fscl_vector_##name##_push_back(cvector_##name* vector, type element) {     \
+        if (vector == NULL) {                                                              \
+            return fscl_tofu_error(TOFU_WAS_NULLPTR);                                      \
+        }                                                                                  \
+        if (vector->size == vector->capacity) {                                            \
+            if (vector->capacity > SIZE_MAX / 2 / sizeof(type)) {                          \
+                return fscl_tofu_error(TOFU_WAS_BAD_RANGE); /* Vector would overflow */    \
+            }                                                                              \
+            size_t capacity = vector->capacity == 0 ? FSCL_VECTOR_TYPED_INITIAL_CAPACITY : vector->capacity * 2; \
+            type* data = (type*)realloc(vector->data, capacity * sizeof(type));            \
+            if (data == NULL) {                                                            \
+                return fscl_tofu_error(TOFU_WAS_BAD_MALLOC);                               \
+            }                                                                              \
+            vector->data = data;                                                           \
+            vector->capacity = capacity;                                                   \
+        }                                                                                  \
+        vector->data[vector->size++] = element;                                            \
+        return fscl_tofu_error(TOFU_SUCCESS);                                              \
+    }                                                                                      \
+                                                                                           \
+    void fscl_vector_##name##_reverse(cvector_##name* vector) {                            \
+        if (vector == NULL || vector->size < 2) {                                          \
+            return;                                                                        \
+        }                                                                                  \
+        for (size_t i = 0, j = vector->size - 1; i < j; ++i, --j) {                        \
+            type temp = vector->data[i];                                                   \
+            vector->data[i] = vector->data[j];                                             \
+            vector->data[j] = temp;                                                        \
+        }                                                                                  \
+    }                                                                                      \
+                                                                                           \
+    ctofu_error fscl_vector_##name##_setter(cvector_##name* vector, size_t index, type element) { \
+        if (vector == NULL) {                                                              \
+            return fscl_tofu_error(TOFU_WAS_NULLPTR);                                      \
+        }                                                                                  \
+        if (index >= vector->size) {                                                       \
+            return fscl_tofu_error(TOFU_WAS_BAD_RANGE);                                    \
+        }                                                                                  \
+        vector->data[index] = element;                                                     \
+        return fscl_tofu_error(TOFU_SUCCESS);                                              \
+    }                                                                                      \
+                                                                                           \
+    ctofu_error fscl_vector_##name##_getter(const cvector_##name* vector, size_t index, type* element) { \
+        if (vector == NULL || element == NULL) {                                           \
+            return fscl_tofu_error(TOFU_WAS_NULLPTR);                                      \
+        }                                                                                  \
+        if (index >= vector->size) {                                                       \
+            return fscl_tofu_error(TOFU_WAS_BAD_RANGE);                                    \
+        }                                                                                  \
+        *element = vector->data[index];                                                    \
+        return fscl_tofu_error(TOFU_SUCCESS);                                              \
+    }                                                                                      \
+                                                                                           \
+    size_t fscl_vector_##name##_size(const cvector_##name* vector) {                       \
+        return vector != NULL ? vector->size : 0;                                          \
+    }                                                                                      \
+                                                                                           \
+    bool fscl_vector_##name##_is_cnullptr(const cvector_##name* vector) {                  \
+        return vector == NULL;                                                             \
+    }                                                                                      \
+                                                                                           \
+    bool fscl_vector_##name##_not_cnullptr(const cvector_##name* vector) {                 \
+        return vector != NULL;                                                             \
+    }                                                                                      \
+                                                                                           \
+    bool fscl_vector_##name##_is_empty(const cvector_##name* vector) {                     \
+        return vector == NULL || vector->size == 0;                                        \
+    }                                                                                      \
+                                                                                           \
+    bool fscl_vector_##name##_not_empty(const cvector_##name* vector) {                    \
+        return vector != NULL && vector->size != 0;                                        \
+    }
+
+// =======================
+// INSTANCES
+// =======================
+
+FSCL_VECTOR_TYPED_DECLARE(i32, int32_t)
+FSCL_VECTOR_TYPED_DECLARE(i64, int64_t)
+FSCL_VECTOR_TYPED_DECLARE(u64, uint64_t)
+FSCL_VECTOR_TYPED_DECLARE(f32, float)
+FSCL_VECTOR_TYPED_DECLARE(f64, double)
+FSCL_VECTOR_TYPED_DECLARE(ptr, void*)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
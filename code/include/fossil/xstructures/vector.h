@@ -22,13 +22,29 @@ extern "C"
 
 #define INITIAL_CAPACITY 10
 
+// How a full vector picks its next capacity
+typedef enum {
+    VECTOR_GROWTH_DOUBLE,  // Twice the current capacity
+    VECTOR_GROWTH_HALF,    // One and a half times the current capacity
+    VECTOR_GROWTH_STEP     // The current capacity plus a fixed step
+} cvector_growth;
+
 typedef struct {
     ctofu* data;
     size_t size;
     size_t capacity;
     ctofu_type expected_type;
+    cvector_growth growth;   // Growth policy, VECTOR_GROWTH_DOUBLE by default
+    size_t growth_step;      // Elements added per growth under VECTOR_GROWTH_STEP
 } cvector;
 
+// Callbacks of the parallel functions. They run on several threads at
+// once, each call on a different element, and must be safe to run so.
+typedef void (*cvector_for_each_fn)(const ctofu* element, void* context);
+typedef void (*cvector_reduce_fn)(ctofu* accumulator, const ctofu* element, void* context);
+typedef bool (*cvector_predicate_fn)(const ctofu* element, void* context);
+typedef ctofu (*cvector_transform_fn)(const ctofu* element, void* context);
+
 // =======================
 // CREATE and DELETE
 // =======================
@@ -48,6 +64,58 @@ cvector fscl_vector_create(ctofu_type expected_type);
  */
 void fscl_vector_erase(cvector* vector);
 
+// =======================
+// CAPACITY FUNCTIONS
+// =======================
+/**
+ * Make room for at least capacity elements, so that pushing up to that many
+ * never reallocates. The capacity never shrinks here.
+ *
+ * @param vector   The vector to reserve room in.
+ * @param capacity The number of elements to make room for.
+ * @return         TOFU_SUCCESS, or TOFU_WAS_BAD_MALLOC with the vector unchanged.
+ */
+ctofu_error fscl_vector_reserve(cvector* vector, size_t capacity);
+
+/**
+ * Give back the memory held beyond the current size.
+ *
+ * @param vector The vector to shrink.
+ * @return       TOFU_SUCCESS, or TOFU_WAS_BAD_MALLOC with the vector unchanged.
+ */
+ctofu_error fscl_vector_shrink_to_fit(cvector* vector);
+
+/**
+ * Change the number of elements. A smaller size drops the elements past
+ * it; a larger size appends copies of fill.
+ *
+ * @param vector The vector to resize.
+ * @param size   The new number of elements.
+ * @param fill   The element appended when growing.
+ * @return       TOFU_SUCCESS, TOFU_WAS_MISMATCH if fill has the wrong type,
+ *               or TOFU_WAS_BAD_MALLOC with the vector unchanged.
+ */
+ctofu_error fscl_vector_resize(cvector* vector, size_t size, ctofu fill);
+
+/**
+ * Choose how the vector grows once it is full.
+ *
+ * @param vector The vector to configure.
+ * @param growth The growth policy.
+ * @param step   Elements added per growth under VECTOR_GROWTH_STEP, at least 1;
+ *               ignored by the other policies.
+ * @return       TOFU_SUCCESS, or TOFU_WAS_BAD_RANGE for a zero step.
+ */
+ctofu_error fscl_vector_set_growth(cvector* vector, cvector_growth growth, size_t step);
+
+/**
+ * Get the number of elements the vector holds without reallocating.
+ *
+ * @param vector The vector for which to get the capacity.
+ * @return       The capacity of the vector.
+ */
+size_t fscl_vector_capacity(const cvector* vector);
+
 // =======================
 // ALGORITHM FUNCTIONS
 // =======================
@@ -59,6 +127,51 @@ void fscl_vector_erase(cvector* vector);
  */
 void fscl_vector_push_back(cvector* vector, ctofu element);
 
+/**
+ * Add n elements to the end of the vector, growing it at most once.
+ *
+ * @param vector   The vector to which the elements will be added.
+ * @param elements The elements to add, which may lie in the vector itself.
+ * @param n        The number of elements.
+ * @return         TOFU_SUCCESS, TOFU_WAS_MISMATCH if any element has the
+ *                 wrong type, or TOFU_WAS_BAD_MALLOC. The vector is left
+ *                 unchanged on failure.
+ */
+ctofu_error fscl_vector_append(cvector* vector, const ctofu* elements, size_t n);
+
+/**
+ * Insert n elements before position index, shifting the tail once.
+ *
+ * @param vector   The vector into which the elements will be inserted.
+ * @param index    The position of the first inserted element, at most the size.
+ * @param elements The elements to insert, which may lie in the vector itself.
+ * @param n        The number of elements.
+ * @return         TOFU_SUCCESS, TOFU_WAS_BAD_RANGE for an index past the end,
+ *                 TOFU_WAS_MISMATCH if any element has the wrong type, or
+ *                 TOFU_WAS_BAD_MALLOC. The vector is left unchanged on failure.
+ */
+ctofu_error fscl_vector_insert_range(cvector* vector, size_t index, const ctofu* elements, size_t n);
+
+/**
+ * Remove n elements starting at position index, shifting the tail once.
+ *
+ * @param vector The vector from which the elements will be removed.
+ * @param index  The position of the first removed element.
+ * @param n      The number of elements.
+ * @return       TOFU_SUCCESS, or TOFU_WAS_BAD_RANGE if the range passes the end.
+ */
+ctofu_error fscl_vector_erase_range(cvector* vector, size_t index, size_t n);
+
+/**
+ * Add every element of another vector of the same type to the end of the vector.
+ *
+ * @param vector The vector to which the elements will be added.
+ * @param other  The vector whose elements are added; may be vector itself.
+ * @return       TOFU_SUCCESS, TOFU_WAS_MISMATCH if the types differ, or
+ *               TOFU_WAS_BAD_MALLOC with the vector unchanged.
+ */
+ctofu_error fscl_vector_extend(cvector* vector, const cvector* other);
+
 /**
  * Search for a target element in the vector.
  *
@@ -68,6 +181,19 @@ void fscl_vector_push_back(cvector* vector, ctofu element);
  */
 int fscl_vector_search(const cvector* vector, ctofu target);
 
+/**
+ * Find every element equal to target. Integer and floating-point vectors
+ * compare several payloads per instruction where the CPU allows it;
+ * floating-point payloads compare with ==, so NaN matches nothing.
+ *
+ * @param vector   The vector to search.
+ * @param target   The element to search for.
+ * @param indexes  Receives the indexes of the matches in increasing order.
+ * @param capacity The number of indexes that fit in indexes.
+ * @return         The number of matches, which may exceed capacity.
+ */
+size_t fscl_vector_find_all(const cvector* vector, ctofu target, size_t* indexes, size_t capacity);
+
 /**
  * Reverse the order of elements in the vector.
  *
@@ -75,6 +201,132 @@ int fscl_vector_search(const cvector* vector, ctofu target);
  */
 void fscl_vector_reverse(cvector* vector);
 
+// =======================
+// SORT FUNCTIONS
+// =======================
+/**
+ * Sort the elements in ascending order of fscl_tofu_compare. Integer
+ * vectors of more than a few hundred elements are radix sorted; others use
+ * introsort, which stays O(n log n) whatever the input order. The sort is
+ * not stable.
+ *
+ * @param vector The vector to sort.
+ * @return       TOFU_SUCCESS, or TOFU_WAS_NULLPTR.
+ */
+ctofu_error fscl_vector_sort(cvector* vector);
+
+/**
+ * Sort the elements like fscl_vector_sort, on several threads. Integer
+ * vectors use a parallel radix sort; others sort one run per thread and
+ * merge the runs pairwise, splitting every merge round across all threads.
+ * One scratch buffer is allocated for the whole sort. Vectors too small to
+ * split, or whose scratch buffer cannot be allocated, are sorted on the
+ * calling thread.
+ *
+ * @param vector   The vector to sort.
+ * @param nthreads The number of threads to use, or 0 for one per processor.
+ * @return         TOFU_SUCCESS, or TOFU_WAS_NULLPTR.
+ */
+ctofu_error fscl_vector_sort_parallel(cvector* vector, size_t nthreads);
+
+/**
+ * Check whether the elements are in ascending order.
+ *
+ * @param vector The vector to check.
+ * @return       True if no element is smaller than the one before it.
+ */
+bool fscl_vector_is_sorted(const cvector* vector);
+
+/**
+ * Find the first element of a sorted vector that is not less than target.
+ *
+ * @param vector The sorted vector to search.
+ * @param target The element to search for, of the expected type.
+ * @return       The index of that element, or the size if there is none.
+ */
+size_t fscl_vector_lower_bound(const cvector* vector, ctofu target);
+
+/**
+ * Find the first element of a sorted vector that is greater than target.
+ *
+ * @param vector The sorted vector to search.
+ * @param target The element to search for, of the expected type.
+ * @return       The index of that element, or the size if there is none.
+ */
+size_t fscl_vector_upper_bound(const cvector* vector, ctofu target);
+
+/**
+ * Search a sorted vector for target in O(log n).
+ *
+ * @param vector The sorted vector to search.
+ * @param target The element to search for.
+ * @return       The index of the first element equal to target, or -1 if not found.
+ */
+int fscl_vector_binary_search(const cvector* vector, ctofu target);
+
+// =======================
+// PARALLEL FUNCTIONS
+// =======================
+
+// These split the vector into one contiguous chunk per thread and run the
+// chunks on the shared worker pool. Vectors too small to be worth
+// splitting run on the calling thread. nthreads of 0 means one thread per
+// processor.
+
+/**
+ * Call fn on every element.
+ *
+ * @param vector   The vector to visit.
+ * @param fn       The function to call with each element.
+ * @param context  Pointer passed through to fn.
+ * @param nthreads The number of threads to use, or 0 for one per processor.
+ * @return         TOFU_SUCCESS, or TOFU_WAS_NULLPTR.
+ */
+ctofu_error fscl_vector_for_each_parallel(const cvector* vector, cvector_for_each_fn fn, void* context, size_t nthreads);
+
+/**
+ * Fold the elements into one value. Each thread folds its chunk into its
+ * own accumulator starting from identity, and the accumulators are then
+ * folded together in chunk order with the same fn, so fn must be
+ * associative and identity must leave a value unchanged.
+ *
+ * @param vector   The vector to reduce.
+ * @param fn       The function folding an element into an accumulator.
+ * @param identity The starting value of every accumulator.
+ * @param context  Pointer passed through to fn.
+ * @param result   Where to store the reduced value; identity when empty.
+ * @param nthreads The number of threads to use, or 0 for one per processor.
+ * @return         TOFU_SUCCESS, TOFU_WAS_NULLPTR, or TOFU_WAS_BAD_MALLOC.
+ */
+ctofu_error fscl_vector_reduce_parallel(const cvector* vector, cvector_reduce_fn fn, ctofu identity, void* context, ctofu* result, size_t nthreads);
+
+/**
+ * Append the elements for which predicate holds to out, in order. out may
+ * be the vector itself.
+ *
+ * @param vector    The vector to filter.
+ * @param predicate The function deciding which elements to keep.
+ * @param context   Pointer passed through to predicate.
+ * @param out       The vector to append the kept elements to.
+ * @param nthreads  The number of threads to use, or 0 for one per processor.
+ * @return          TOFU_SUCCESS, TOFU_WAS_NULLPTR, TOFU_WAS_MISMATCH when
+ *                  out expects another type, or TOFU_WAS_BAD_MALLOC.
+ */
+ctofu_error fscl_vector_filter(const cvector* vector, cvector_predicate_fn predicate, void* context, cvector* out, size_t nthreads);
+
+/**
+ * Replace every element with fn applied to it. Results of another type
+ * than the vector expects are not stored, leaving that element unchanged.
+ *
+ * @param vector   The vector to transform.
+ * @param fn       The function computing the new value of an element.
+ * @param context  Pointer passed through to fn.
+ * @param nthreads The number of threads to use, or 0 for one per processor.
+ * @return         TOFU_SUCCESS, TOFU_WAS_NULLPTR, TOFU_WAS_MISMATCH when
+ *                 any result had the wrong type, or TOFU_WAS_BAD_MALLOC.
+ */
+ctofu_error fscl_vector_transform(cvector* vector, cvector_transform_fn fn, void* context, size_t nthreads);
+
 // =======================
 // UTILITY FUNCTIONS
 // =======================
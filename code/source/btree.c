@@ -0,0 +1,701 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/xstructures/btree.h"
+#include <stdlib.h>
+#include <string.h>
+
+// =======================
+// NODE HELPERS
+// =======================
+
+// Helper function to count the keys of a node that are less than key, or
+// not greater than key when after_equal is set, by binary search
+static size_t fscl_btree_bound(const cbtree_node* node, const ctofu* key, bool after_equal) {
+    size_t low = 0;
+    size_t high = node->count;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        int compare_result = fscl_tofu_compare(&node->keys[mid], key);
+        if (compare_result < 0 || (after_equal && compare_result == 0)) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+
+    return low;
+}
+
+// Helper function to check that a key has the type of the tree. Keys of
+// other types have no order against the stored keys: fscl_tofu_compare
+// returns an error code for them rather than a sign.
+static bool fscl_btree_key_fits(const cbtree* tree, const ctofu* key) {
+    return key->type == tree->tree;
+}
+
+// Helper function to find the leaf whose key range covers key
+static const cbtree_leaf* fscl_btree_find_leaf(const cbtree* tree, const ctofu* key) {
+    const cbtree_node* node = tree->root;
+    while (node != NULL && !node->leaf) {
+        node = ((const cbtree_inner*)node)->children[fscl_btree_bound(node, key, true)];
+    }
+
+    return (const cbtree_leaf*)node;
+}
+
+// Helper function to find the value stored for key, or NULL
+static ctofu* fscl_btree_find_value(const cbtree* tree, const ctofu* key) {
+    const cbtree_leaf* leaf = fscl_btree_find_leaf(tree, key);
+    if (leaf == NULL) {
+        return NULL;
+    }
+
+    size_t pos = fscl_btree_bound(&leaf->node, key, false);
+    if (pos == leaf->node.count || fscl_tofu_compare(&leaf->node.keys[pos], key) != 0) {
+        return NULL;
+    }
+
+    return (ctofu*)&leaf->values[pos];
+}
+
+static cbtree_leaf* fscl_btree_leaf_create(void) {
+    cbtree_leaf* leaf = (cbtree_leaf*)malloc(sizeof(cbtree_leaf));
+    if (leaf != NULL) {
+        leaf->node.count = 0;
+        leaf->node.leaf = true;
+        leaf->next = NULL;
+    }
+
+    return leaf;
+}
+
+static cbtree_inner* fscl_btree_inner_create(void) {
+    cbtree_inner* inner = (cbtree_inner*)malloc(sizeof(cbtree_inner));
+    if (inner != NULL) {
+        inner->node.count = 0;
+        inner->node.leaf = false;
+    }
+
+    return inner;
+}
+
+// Helper function to free a subtree
+static void fscl_btree_node_erase(cbtree_node* node) {
+    if (node == NULL) {
+        return;
+    }
+
+    if (!node->leaf) {
+        cbtree_inner* inner = (cbtree_inner*)node;
+        for (size_t i = 0; i <= node->count; i++) {
+            fscl_btree_node_erase(inner->children[i]);
+        }
+    }
+
+    free(node);
+}
+
+// =======================
+// INSERT HELPERS
+// =======================
+
+// Most levels a tree can have: every node but the root holds at least
+// BTREE_MIN_KEYS + 1 children, so this many levels outnumber any size_t
+#define BTREE_MAX_HEIGHT 64
+
+// Nodes allocated before an insert changes anything, one for each split
+// it may cause, so a failed allocation leaves the tree untouched
+typedef struct {
+    cbtree_leaf* leaf;                        // Right half of a split leaf
+    cbtree_inner* inner[BTREE_MAX_HEIGHT];    // Split inner nodes and a new root
+    size_t inner_count;
+} cbtree_spares;
+
+// Helper function to free the spares an insert did not use
+static void fscl_btree_spares_release(cbtree_spares* spares) {
+    free(spares->leaf);
+    for (size_t i = 0; i < spares->inner_count; i++) {
+        free(spares->inner[i]);
+    }
+}
+
+// Helper function to allocate the nodes inserting key may need. Walking
+// down to its leaf, a split reaches a level only through a run of full
+// nodes from the leaf up, and a root split adds one more inner node.
+static bool fscl_btree_spares_reserve(const cbtree* tree, const ctofu* key, cbtree_spares* spares) {
+    memset(spares, 0, sizeof(*spares));
+
+    bool full[BTREE_MAX_HEIGHT];
+    size_t depth = 0;
+    const cbtree_node* node = tree->root;
+    while (!node->leaf) {
+        full[depth++] = node->count == BTREE_MAX_KEYS;
+        node = ((const cbtree_inner*)node)->children[fscl_btree_bound(node, key, true)];
+    }
+
+    if (node->count < BTREE_MAX_KEYS) {
+        return true; // The leaf takes the key without splitting
+    }
+
+    size_t needed = 1; // A new root, unless a level below it has room
+    while (depth > 0 && full[depth - 1]) {
+        needed++;
+        depth--;
+    }
+    if (depth > 0) {
+        needed--; // That level takes the split key without splitting
+    }
+
+    spares->leaf = fscl_btree_leaf_create();
+    for (size_t i = 0; spares->leaf != NULL && i < needed; i++) {
+        spares->inner[i] = fscl_btree_inner_create();
+        if (spares->inner[i] == NULL) {
+            break;
+        }
+        spares->inner_count++;
+    }
+
+    if (spares->leaf == NULL || spares->inner_count < needed) {
+        fscl_btree_spares_release(spares);
+        return false;
+    }
+
+    return true;
+}
+
+// Helper function to take one of the inner nodes reserved for an insert
+static cbtree_inner* fscl_btree_spares_inner(cbtree_spares* spares) {
+    return spares->inner[--spares->inner_count];
+}
+
+// Helper function to insert into a leaf. A full leaf is split in two, with
+// the right half taken from spares and returned through split with its
+// smallest key.
+static ctofu_error fscl_btree_leaf_insert(cbtree_leaf* leaf, const ctofu* key, const ctofu* value, cbtree_spares* spares, ctofu* split_key, cbtree_node** split) {
+    size_t pos = fscl_btree_bound(&leaf->node, key, false);
+    if (pos < leaf->node.count && fscl_tofu_compare(&leaf->node.keys[pos], key) == 0) {
+        return fscl_tofu_error(TOFU_WAS_MISMATCH); // Duplicate key
+    }
+
+    cbtree_leaf* target = leaf;
+    if (leaf->node.count == BTREE_MAX_KEYS) {
+        cbtree_leaf* right = spares->leaf;
+        spares->leaf = NULL;
+
+        // The left half keeps one more key when the new key lands there
+        size_t keep = pos <= BTREE_MAX_KEYS / 2 ? BTREE_MAX_KEYS / 2 : BTREE_MAX_KEYS / 2 + 1;
+        right->node.count = BTREE_MAX_KEYS - keep;
+        memcpy(right->node.keys, &leaf->node.keys[keep], right->node.count * sizeof(ctofu));
+        memcpy(right->values, &leaf->values[keep], right->node.count * sizeof(ctofu));
+        leaf->node.count = keep;
+
+        right->next = leaf->next;
+        leaf->next = right;
+        *split = &right->node;
+
+        if (pos > BTREE_MAX_KEYS / 2) {
+            target = right;
+            pos -= keep;
+        }
+    }
+
+    size_t tail = target->node.count - pos;
+    memmove(&target->node.keys[pos + 1], &target->node.keys[pos], tail * sizeof(ctofu));
+    memmove(&target->values[pos + 1], &target->values[pos], tail * sizeof(ctofu));
+    target->node.keys[pos] = *key;
+    target->values[pos] = *value;
+    target->node.count++;
+
+    if (*split != NULL) {
+        *split_key = ((cbtree_leaf*)*split)->node.keys[0];
+    }
+
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+// Helper function to add a separator and the child to its right at pos
+// of an inner node. A full node is split around its middle key, which
+// moves up through split_key with the new right half, taken from spares,
+// in split.
+static void fscl_btree_inner_insert(cbtree_inner* inner, size_t pos, const ctofu* key, cbtree_node* child, cbtree_spares* spares, ctofu* split_key, cbtree_node** split) {
+    if (inner->node.count < BTREE_MAX_KEYS) {
+        size_t tail = inner->node.count - pos;
+        memmove(&inner->node.keys[pos + 1], &inner->node.keys[pos], tail * sizeof(ctofu));
+        memmove(&inner->children[pos + 2], &inner->children[pos + 1], tail * sizeof(cbtree_node*));
+        inner->node.keys[pos] = *key;
+        inner->children[pos + 1] = child;
+        inner->node.count++;
+        return;
+    }
+
+    cbtree_inner* right = fscl_btree_spares_inner(spares);
+
+    // Lay out all keys and children in order, then cut around the middle
+    ctofu keys[BTREE_MAX_KEYS + 1];
+    cbtree_node* children[BTREE_MAX_KEYS + 2];
+    memcpy(keys, inner->node.keys, pos * sizeof(ctofu));
+    keys[pos] = *key;
+    memcpy(&keys[pos + 1], &inner->node.keys[pos], (BTREE_MAX_KEYS - pos) * sizeof(ctofu));
+    memcpy(children, inner->children, (pos + 1) * sizeof(cbtree_node*));
+    children[pos + 1] = child;
+    memcpy(&children[pos + 2], &inner->children[pos + 1], (BTREE_MAX_KEYS - pos) * sizeof(cbtree_node*));
+
+    size_t middle = BTREE_MAX_KEYS / 2;
+    inner->node.count = middle;
+    memcpy(inner->node.keys, keys, middle * sizeof(ctofu));
+    memcpy(inner->children, children, (middle + 1) * sizeof(cbtree_node*));
+
+    right->node.count = BTREE_MAX_KEYS - middle;
+    memcpy(right->node.keys, &keys[middle + 1], right->node.count * sizeof(ctofu));
+    memcpy(right->children, &children[middle + 1], (right->node.count + 1) * sizeof(cbtree_node*));
+
+    *split_key = keys[middle];
+    *split = &right->node;
+}
+
+// Helper function to insert below node, passing splits up to the caller
+static ctofu_error fscl_btree_node_insert(cbtree_node* node, const ctofu* key, const ctofu* value, cbtree_spares* spares, ctofu* split_key, cbtree_node** split) {
+    if (node->leaf) {
+        return fscl_btree_leaf_insert((cbtree_leaf*)node, key, value, spares, split_key, split);
+    }
+
+    cbtree_inner* inner = (cbtree_inner*)node;
+    size_t pos = fscl_btree_bound(node, key, true);
+
+    ctofu child_key;
+    cbtree_node* child_split = NULL;
+    ctofu_error result = fscl_btree_node_insert(inner->children[pos], key, value, spares, &child_key, &child_split);
+    if (result == TOFU_SUCCESS && child_split != NULL) {
+        fscl_btree_inner_insert(inner, pos, &child_key, child_split, spares, split_key, split);
+    }
+
+    return result;
+}
+
+// =======================
+// REMOVE HELPERS
+// =======================
+
+// Helper function to move one pair or child from the left sibling of
+// children[pos] into it
+static void fscl_btree_borrow_left(cbtree_inner* parent, size_t pos) {
+    cbtree_node* child = parent->children[pos];
+    cbtree_node* left = parent->children[pos - 1];
+
+    memmove(&child->keys[1], child->keys, child->count * sizeof(ctofu));
+    if (child->leaf) {
+        cbtree_leaf* child_leaf = (cbtree_leaf*)child;
+        cbtree_leaf* left_leaf = (cbtree_leaf*)left;
+        memmove(&child_leaf->values[1], child_leaf->values, child->count * sizeof(ctofu));
+        child->keys[0] = left->keys[left->count - 1];
+        child_leaf->values[0] = left_leaf->values[left->count - 1];
+        parent->node.keys[pos - 1] = child->keys[0];
+    } else {
+        cbtree_inner* child_inner = (cbtree_inner*)child;
+        cbtree_inner* left_inner = (cbtree_inner*)left;
+        memmove(&child_inner->children[1], child_inner->children, (child->count + 1) * sizeof(cbtree_node*));
+        child->keys[0] = parent->node.keys[pos - 1];
+        child_inner->children[0] = left_inner->children[left->count];
+        parent->node.keys[pos - 1] = left->keys[left->count - 1];
+    }
+
+    child->count++;
+    left->count--;
+}
+
+// Helper function to move one pair or child from the right sibling of
+// children[pos] into it
+static void fscl_btree_borrow_right(cbtree_inner* parent, size_t pos) {
+    cbtree_node* child = parent->children[pos];
+    cbtree_node* right = parent->children[pos + 1];
+
+    if (child->leaf) {
+        cbtree_leaf* child_leaf = (cbtree_leaf*)child;
+        cbtree_leaf* right_leaf = (cbtree_leaf*)right;
+        child->keys[child->count] = right->keys[0];
+        child_leaf->values[child->count] = right_leaf->values[0];
+        memmove(right->keys, &right->keys[1], (right->count - 1) * sizeof(ctofu));
+        memmove(right_leaf->values, &right_leaf->values[1], (right->count - 1) * sizeof(ctofu));
+        parent->node.keys[pos] = right->keys[0];
+    } else {
+        cbtree_inner* child_inner = (cbtree_inner*)child;
+        cbtree_inner* right_inner = (cbtree_inner*)right;
+        child->keys[child->count] = parent->node.keys[pos];
+        child_inner->children[child->count + 1] = right_inner->children[0];
+        parent->node.keys[pos] = right->keys[0];
+        memmove(right->keys, &right->keys[1], (right->count - 1) * sizeof(ctofu));
+        memmove(right_inner->children, &right_inner->children[1], right->count * sizeof(cbtree_node*));
+    }
+
+    child->count++;
+    right->count--;
+}
+
+// Helper function to merge children[pos + 1] into children[pos] and drop
+// the separator between them
+static void fscl_btree_merge(cbtree_inner* parent, size_t pos) {
+    cbtree_node* left = parent->children[pos];
+    cbtree_node* right = parent->children[pos + 1];
+
+    if (left->leaf) {
+        cbtree_leaf* left_leaf = (cbtree_leaf*)left;
+        cbtree_leaf* right_leaf = (cbtree_leaf*)right;
+        memcpy(&left->keys[left->count], right->keys, right->count * sizeof(ctofu));
+        memcpy(&left_leaf->values[left->count], right_leaf->values, right->count * sizeof(ctofu));
+        left->count += right->count;
+        left_leaf->next = right_leaf->next;
+    } else {
+        cbtree_inner* left_inner = (cbtree_inner*)left;
+        cbtree_inner* right_inner = (cbtree_inner*)right;
+        left->keys[left->count] = parent->node.keys[pos];
+        memcpy(&left->keys[left->count + 1], right->keys, right->count * sizeof(ctofu));
+        memcpy(&left_inner->children[left->count + 1], right_inner->children, (right->count + 1) * sizeof(cbtree_node*));
+        left->count += right->count + 1;
+    }
+    free(right);
+
+    size_t tail = parent->node.count - pos - 1;
+    memmove(&parent->node.keys[pos], &parent->node.keys[pos + 1], tail * sizeof(ctofu));
+    memmove(&parent->children[pos + 1], &parent->children[pos + 2], tail * sizeof(cbtree_node*));
+    parent->node.count--;
+}
+
+// Helper function to refill children[pos] after it fell below the minimum
+static void fscl_btree_rebalance(cbtree_inner* parent, size_t pos) {
+    if (pos > 0 && parent->children[pos - 1]->count > BTREE_MIN_KEYS) {
+        fscl_btree_borrow_left(parent, pos);
+    } else if (pos < parent->node.count && parent->children[pos + 1]->count > BTREE_MIN_KEYS) {
+        fscl_btree_borrow_right(parent, pos);
+    } else if (pos > 0) {
+        fscl_btree_merge(parent, pos - 1);
+    } else {
+        fscl_btree_merge(parent, pos);
+    }
+}
+
+// Helper function to remove key below node, rebalancing on the way back up
+static bool fscl_btree_node_remove(cbtree_node* node, const ctofu* key) {
+    if (node->leaf) {
+        cbtree_leaf* leaf = (cbtree_leaf*)node;
+        size_t pos = fscl_btree_bound(node, key, false);
+        if (pos == node->count || fscl_tofu_compare(&node->keys[pos], key) != 0) {
+            return false;
+        }
+
+        size_t tail = node->count - pos - 1;
+        memmove(&node->keys[pos], &node->keys[pos + 1], tail * sizeof(ctofu));
+        memmove(&leaf->values[pos], &leaf->values[pos + 1], tail * sizeof(ctofu));
+        node->count--;
+        return true;
+    }
+
+    cbtree_inner* inner = (cbtree_inner*)node;
+    size_t pos = fscl_btree_bound(node, key, true);
+    if (!fscl_btree_node_remove(inner->children[pos], key)) {
+        return false;
+    }
+
+    if (inner->children[pos]->count < BTREE_MIN_KEYS) {
+        fscl_btree_rebalance(inner, pos);
+    }
+
+    return true;
+}
+
+// =======================
+// CURSOR HELPERS
+// =======================
+
+// Helper function to step a cursor off the end of its leaf
+static void fscl_btree_cursor_settle(cbtree_cursor* cursor) {
+    if (cursor->leaf != NULL && cursor->index >= cursor->leaf->node.count) {
+        cursor->leaf = cursor->leaf->next;
+        cursor->index = 0;
+    }
+}
+
+// Helper function to place a cursor at the first key past key, or not
+// less than key unless after_equal is set
+static cbtree_cursor fscl_btree_seek(const cbtree* tree, const ctofu* key, bool after_equal) {
+    cbtree_cursor cursor;
+    memset(&cursor, 0, sizeof(cursor));
+
+    if (tree == NULL || !fscl_btree_key_fits(tree, key)) {
+        return cursor;
+    }
+
+    cursor.leaf = fscl_btree_find_leaf(tree, key);
+    if (cursor.leaf != NULL) {
+        cursor.index = fscl_btree_bound(&cursor.leaf->node, key, after_equal);
+        fscl_btree_cursor_settle(&cursor);
+    }
+
+    return cursor;
+}
+
+// =======================
+// CREATE and DELETE
+// =======================
+
+cbtree* fscl_btree_create(ctofu_type tree) {
+    cbtree* new_tree = (cbtree*)malloc(sizeof(cbtree));
+    if (new_tree == NULL) {
+        // Handle memory allocation failure
+        return NULL;
+    }
+
+    // The first leaf is allocated on the first insert
+    new_tree->root = NULL;
+    new_tree->first = NULL;
+    new_tree->size = 0;
+    new_tree->tree = tree;
+
+    return new_tree;
+}
+
+void fscl_btree_erase(cbtree* tree) {
+    if (tree == NULL) {
+        return;
+    }
+
+    fscl_btree_node_erase(tree->root);
+    free(tree);
+}
+
+// =======================
+// ALGORITHM FUNCTIONS
+// =======================
+
+ctofu_error fscl_btree_insert(cbtree* tree, ctofu key, ctofu value) {
+    if (tree == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    // Check if the key type matches the type of the tree
+    if (!fscl_btree_key_fits(tree, &key)) {
+        return fscl_tofu_error(TOFU_WAS_MISMATCH);
+    }
+
+    if (tree->root == NULL) {
+        cbtree_leaf* leaf = fscl_btree_leaf_create();
+        if (leaf == NULL) {
+            return fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+        }
+        tree->root = &leaf->node;
+        tree->first = leaf;
+    }
+
+    // Allocate every node the splits may need before touching the tree
+    cbtree_spares spares;
+    if (!fscl_btree_spares_reserve(tree, &key, &spares)) {
+        return fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+    }
+
+    ctofu split_key;
+    cbtree_node* split = NULL;
+    ctofu_error result = fscl_btree_node_insert(tree->root, &key, &value, &spares, &split_key, &split);
+    if (result != TOFU_SUCCESS) {
+        fscl_btree_spares_release(&spares);
+        return result;
+    }
+
+    // A split root grows the tree by one level
+    if (split != NULL) {
+        cbtree_inner* root = fscl_btree_spares_inner(&spares);
+        root->node.count = 1;
+        root->node.keys[0] = split_key;
+        root->children[0] = tree->root;
+        root->children[1] = split;
+        tree->root = &root->node;
+    }
+
+    fscl_btree_spares_release(&spares);
+    tree->size++;
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+ctofu_error fscl_btree_remove(cbtree* tree, ctofu key) {
+    if (tree == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    if (!fscl_btree_key_fits(tree, &key)) {
+        return fscl_tofu_error(TOFU_WAS_MISMATCH);
+    }
+
+    if (tree->root == NULL || !fscl_btree_node_remove(tree->root, &key)) {
+        return fscl_tofu_error(TOFU_NOT_FOUND); // Key not found
+    }
+    tree->size--;
+
+    // An inner root left with one child shrinks the tree by one level
+    cbtree_node* root = tree->root;
+    if (!root->leaf && root->count == 0) {
+        tree->root = ((cbtree_inner*)root)->children[0];
+        free(root);
+    } else if (root->leaf && root->count == 0) {
+        free(root);
+        tree->root = NULL;
+        tree->first = NULL;
+    }
+
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+ctofu_error fscl_btree_search(const cbtree* tree, ctofu key) {
+    if (tree == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    if (!fscl_btree_key_fits(tree, &key)) {
+        return fscl_tofu_error(TOFU_WAS_MISMATCH);
+    }
+
+    if (fscl_btree_find_value(tree, &key) == NULL) {
+        return fscl_tofu_error(TOFU_NOT_FOUND); // Key not found
+    }
+
+    return fscl_tofu_error(TOFU_SUCCESS); // Found
+}
+
+// =======================
+// CURSOR FUNCTIONS
+// =======================
+
+cbtree_cursor fscl_btree_cursor_start(const cbtree* tree) {
+    cbtree_cursor cursor;
+    memset(&cursor, 0, sizeof(cursor));
+    cursor.leaf = tree != NULL ? tree->first : NULL;
+
+    return cursor;
+}
+
+cbtree_cursor fscl_btree_lower_bound(const cbtree* tree, ctofu key) {
+    return fscl_btree_seek(tree, &key, false);
+}
+
+cbtree_cursor fscl_btree_upper_bound(const cbtree* tree, ctofu key) {
+    return fscl_btree_seek(tree, &key, true);
+}
+
+cbtree_cursor fscl_btree_range(const cbtree* tree, ctofu lo, ctofu hi) {
+    cbtree_cursor cursor = fscl_btree_seek(tree, &lo, false);
+    if (tree != NULL && !fscl_btree_key_fits(tree, &hi)) {
+        cursor.leaf = NULL; // A bound of another type cannot end the range
+    }
+    cursor.end = hi;
+    cursor.bounded = true;
+
+    return cursor;
+}
+
+bool fscl_btree_cursor_valid(const cbtree_cursor* cursor) {
+    if (cursor == NULL || cursor->leaf == NULL) {
+        return false;
+    }
+
+    return !cursor->bounded || fscl_tofu_compare(&cursor->leaf->node.keys[cursor->index], &cursor->end) < 0;
+}
+
+const ctofu* fscl_btree_cursor_key(const cbtree_cursor* cursor) {
+    if (!fscl_btree_cursor_valid(cursor)) {
+        return NULL;
+    }
+
+    return &cursor->leaf->node.keys[cursor->index];
+}
+
+const ctofu* fscl_btree_cursor_value(const cbtree_cursor* cursor) {
+    if (!fscl_btree_cursor_valid(cursor)) {
+        return NULL;
+    }
+
+    return &cursor->leaf->values[cursor->index];
+}
+
+void fscl_btree_cursor_next(cbtree_cursor* cursor) {
+    if (cursor == NULL || cursor->leaf == NULL) {
+        return;
+    }
+
+    cursor->index++;
+    fscl_btree_cursor_settle(cursor);
+}
+
+// =======================
+// UTILITY FUNCTIONS
+// =======================
+
+size_t fscl_btree_size(const cbtree* tree) {
+    if (tree == NULL) {
+        return 0;
+    }
+
+    return tree->size;
+}
+
+ctofu_error fscl_btree_getter(const cbtree* tree, ctofu key, ctofu* value) {
+    if (tree == NULL || value == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    if (!fscl_btree_key_fits(tree, &key)) {
+        return fscl_tofu_error(TOFU_WAS_MISMATCH);
+    }
+
+    const ctofu* found = fscl_btree_find_value(tree, &key);
+    if (found == NULL) {
+        return fscl_tofu_error(TOFU_NOT_FOUND); // Key not found
+    }
+
+    *value = *found;
+    return fscl_tofu_error(TOFU_SUCCESS); // Found
+}
+
+ctofu_error fscl_btree_setter(cbtree* tree, ctofu key, ctofu value) {
+    if (tree == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    if (!fscl_btree_key_fits(tree, &key)) {
+        return fscl_tofu_error(TOFU_WAS_MISMATCH);
+    }
+
+    ctofu* found = fscl_btree_find_value(tree, &key);
+    if (found == NULL) {
+        return fscl_tofu_error(TOFU_NOT_FOUND); // Key not found
+    }
+
+    *found = value;
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+bool fscl_btree_not_empty(const cbtree* tree) {
+    return tree != NULL && tree->size > 0;
+}
+
+bool fscl_btree_not_cnullptr(const cbtree* tree) {
+    return tree != NULL;
+}
+
+bool fscl_btree_is_empty(const cbtree* tree) {
+    return tree == NULL || tree->size == 0;
+}
+
+bool fscl_btree_is_cnullptr(const cbtree* tree) {
+    return tree == NULL;
+}
+
+bool fscl_btree_contains(const cbtree* tree, ctofu key) {
+    return tree != NULL && fscl_btree_key_fits(tree, &key) && fscl_btree_find_value(tree, &key) != NULL;
+}
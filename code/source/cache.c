@@ -0,0 +1,375 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/xstructures/cache.h"
+#include "fossil/xstructures/hash.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Marks the end of a node list
+#define CACHE_NIL UINT32_MAX
+
+#define CACHE_NOT_FOUND ((size_t)-1)
+
+// =======================
+// INDEX HELPERS
+// =======================
+
+// Helper function to find the index slot holding key, or CACHE_NOT_FOUND
+static size_t fscl_cache_index_find(const ccache* cache, const ctofu* key, uint64_t hash) {
+    size_t mask = cache->slot_count - 1;
+    for (size_t pos = (size_t)hash & mask; cache->slots[pos] != 0; pos = (pos + 1) & mask) {
+        const ccache_node* node = &cache->nodes[cache->slots[pos] - 1];
+        if (node->hash == hash && fscl_tofu_compare(&node->key, key) == 0) {
+            return pos;
+        }
+    }
+
+    return CACHE_NOT_FOUND;
+}
+
+// Helper function to find the index slot pointing at a known node
+static size_t fscl_cache_index_find_node(const ccache* cache, uint32_t node) {
+    size_t mask = cache->slot_count - 1;
+    size_t pos = (size_t)cache->nodes[node].hash & mask;
+    while (cache->slots[pos] != node + 1) {
+        pos = (pos + 1) & mask;
+    }
+
+    return pos;
+}
+
+// Helper function to store a node in the first free slot of its probe sequence
+static void fscl_cache_index_place(ccache* cache, uint32_t node) {
+    size_t mask = cache->slot_count - 1;
+    size_t pos = (size_t)cache->nodes[node].hash & mask;
+    while (cache->slots[pos] != 0) {
+        pos = (pos + 1) & mask;
+    }
+
+    cache->slots[pos] = node + 1;
+}
+
+// Helper function to empty a slot, shifting later entries of its cluster
+// back so probes never need tombstones under constant eviction
+static void fscl_cache_index_release(ccache* cache, size_t pos) {
+    size_t mask = cache->slot_count - 1;
+    size_t hole = pos;
+    for (size_t next = (pos + 1) & mask; cache->slots[next] != 0; next = (next + 1) & mask) {
+        size_t home = (size_t)cache->nodes[cache->slots[next] - 1].hash & mask;
+        if (((next - home) & mask) >= ((next - hole) & mask)) {
+            cache->slots[hole] = cache->slots[next];
+            hole = next;
+        }
+    }
+
+    cache->slots[hole] = 0;
+}
+
+// =======================
+// NODE HELPERS
+// =======================
+
+// Helper function to unlink a node from the recency list
+static void fscl_cache_unlink(ccache* cache, uint32_t node) {
+    ccache_node* current = &cache->nodes[node];
+    if (current->prev != CACHE_NIL) {
+        cache->nodes[current->prev].next = current->next;
+    } else {
+        cache->head = current->next;
+    }
+
+    if (current->next != CACHE_NIL) {
+        cache->nodes[current->next].prev = current->prev;
+    } else {
+        cache->tail = current->prev;
+    }
+}
+
+// Helper function to link a node at the most recently used end
+static void fscl_cache_push_front(ccache* cache, uint32_t node) {
+    ccache_node* current = &cache->nodes[node];
+    current->prev = CACHE_NIL;
+    current->next = cache->head;
+    if (cache->head != CACHE_NIL) {
+        cache->nodes[cache->head].prev = node;
+    } else {
+        cache->tail = node;
+    }
+    cache->head = node;
+}
+
+// Helper function to mark a node as just used
+static void fscl_cache_touch(ccache* cache, uint32_t node) {
+    if (cache->policy == CACHE_POLICY_CLOCK) {
+        cache->nodes[node].referenced = true;
+    } else if (cache->head != node) {
+        fscl_cache_unlink(cache, node);
+        fscl_cache_push_front(cache, node);
+    }
+}
+
+// Helper function to pick the node a full cache gives up next
+static uint32_t fscl_cache_victim(ccache* cache) {
+    if (cache->policy == CACHE_POLICY_LRU) {
+        return cache->tail;
+    }
+
+    // Give each referenced node a second chance; a full sweep clears every
+    // bit, so the hand stops within two turns
+    while (cache->nodes[cache->hand].referenced) {
+        cache->nodes[cache->hand].referenced = false;
+        cache->hand = (cache->hand + 1) % cache->capacity;
+    }
+
+    uint32_t victim = (uint32_t)cache->hand;
+    cache->hand = (cache->hand + 1) % cache->capacity;
+    return victim;
+}
+
+// Helper function to drop a node from the index and the recency list and
+// return it to the free list
+static void fscl_cache_release(ccache* cache, uint32_t node, size_t pos) {
+    fscl_cache_index_release(cache, pos);
+    if (cache->policy == CACHE_POLICY_LRU) {
+        fscl_cache_unlink(cache, node);
+    }
+
+    cache->nodes[node].next = cache->free_list;
+    cache->free_list = node;
+    cache->size--;
+}
+
+// =======================
+// CREATE and DELETE
+// =======================
+
+ccache* fscl_cache_create(ctofu_type list_type, size_t capacity, ccache_policy policy) {
+    if (capacity == 0 || capacity > CACHE_MAX_CAPACITY) {
+        return NULL;
+    }
+
+    ccache* new_cache = (ccache*)malloc(sizeof(ccache));
+    if (new_cache == NULL) {
+        // Handle memory allocation failure
+        return NULL;
+    }
+
+    // Keep the index at most half full
+    size_t slot_count = 8;
+    while (slot_count < capacity * 2) {
+        slot_count *= 2;
+    }
+
+    new_cache->nodes = (ccache_node*)malloc(capacity * sizeof(ccache_node));
+    new_cache->slots = (uint32_t*)calloc(slot_count, sizeof(uint32_t));
+    if (new_cache->nodes == NULL || new_cache->slots == NULL) {
+        free(new_cache->nodes);
+        free(new_cache->slots);
+        free(new_cache);
+        return NULL;
+    }
+
+    new_cache->slot_count = slot_count;
+    new_cache->capacity = capacity;
+    new_cache->policy = policy;
+    new_cache->stats.hits = 0;
+    new_cache->stats.misses = 0;
+    new_cache->stats.evictions = 0;
+    new_cache->on_evict = NULL;
+    new_cache->evict_context = NULL;
+    fscl_cache_clear(new_cache);
+
+    return new_cache;
+}
+
+void fscl_cache_erase(ccache* cache) {
+    if (cache == NULL) {
+        return;
+    }
+
+    free(cache->nodes);
+    free(cache->slots);
+    free(cache);
+}
+
+// =======================
+// ALGORITHM FUNCTIONS
+// =======================
+
+ctofu_error fscl_cache_get(ccache* cache, ctofu key, ctofu* value) {
+    if (cache == NULL || value == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    size_t pos = fscl_cache_index_find(cache, &key, fscl_tofu_hash(&key, TOFU_HASH_SEED));
+    if (pos == CACHE_NOT_FOUND) {
+        cache->stats.misses++;
+        return fscl_tofu_error(TOFU_NOT_FOUND); // Key not found
+    }
+
+    uint32_t node = cache->slots[pos] - 1;
+    fscl_cache_touch(cache, node);
+    cache->stats.hits++;
+
+    *value = cache->nodes[node].value;
+    return fscl_tofu_error(TOFU_SUCCESS); // Found
+}
+
+ctofu_error fscl_cache_put(ccache* cache, ctofu key, ctofu value) {
+    if (cache == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    uint64_t hash = fscl_tofu_hash(&key, TOFU_HASH_SEED);
+    size_t pos = fscl_cache_index_find(cache, &key, hash);
+    if (pos != CACHE_NOT_FOUND) {
+        uint32_t node = cache->slots[pos] - 1;
+        cache->nodes[node].value = value;
+        fscl_cache_touch(cache, node);
+        return fscl_tofu_error(TOFU_SUCCESS);
+    }
+
+    if (cache->size == cache->capacity) {
+        uint32_t victim = fscl_cache_victim(cache);
+        ccache_node* evicted = &cache->nodes[victim];
+        fscl_cache_release(cache, victim, fscl_cache_index_find_node(cache, victim));
+        cache->stats.evictions++;
+
+        // The node stays untouched until the callback returns
+        if (cache->on_evict != NULL) {
+            cache->on_evict(&evicted->key, &evicted->value, cache->evict_context);
+        }
+    }
+
+    uint32_t node = cache->free_list;
+    ccache_node* current = &cache->nodes[node];
+    cache->free_list = current->next;
+
+    current->key = key;
+    current->value = value;
+    current->hash = hash;
+    current->referenced = false;
+    if (cache->policy == CACHE_POLICY_LRU) {
+        fscl_cache_push_front(cache, node);
+    }
+
+    fscl_cache_index_place(cache, node);
+    cache->size++;
+
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+ctofu_error fscl_cache_remove(ccache* cache, ctofu key) {
+    if (cache == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    size_t pos = fscl_cache_index_find(cache, &key, fscl_tofu_hash(&key, TOFU_HASH_SEED));
+    if (pos == CACHE_NOT_FOUND) {
+        return fscl_tofu_error(TOFU_NOT_FOUND); // Key not found
+    }
+
+    fscl_cache_release(cache, cache->slots[pos] - 1, pos);
+
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+void fscl_cache_clear(ccache* cache) {
+    if (cache == NULL) {
+        return;
+    }
+
+    memset(cache->slots, 0, cache->slot_count * sizeof(uint32_t));
+    for (size_t i = 0; i < cache->capacity; i++) {
+        cache->nodes[i].referenced = false;
+        cache->nodes[i].next = i + 1 < cache->capacity ? (uint32_t)(i + 1) : CACHE_NIL;
+    }
+
+    cache->size = 0;
+    cache->head = CACHE_NIL;
+    cache->tail = CACHE_NIL;
+    cache->free_list = 0;
+    cache->hand = 0;
+}
+
+// =======================
+// UTILITY FUNCTIONS
+// =======================
+
+bool fscl_cache_contains(const ccache* cache, ctofu key) {
+    if (cache == NULL) {
+        return false;
+    }
+
+    return fscl_cache_index_find(cache, &key, fscl_tofu_hash(&key, TOFU_HASH_SEED)) != CACHE_NOT_FOUND;
+}
+
+void fscl_cache_set_evict_callback(ccache* cache, ccache_evict_fn on_evict, void* context) {
+    if (cache == NULL) {
+        return;
+    }
+
+    cache->on_evict = on_evict;
+    cache->evict_context = context;
+}
+
+ccache_stats fscl_cache_stats(const ccache* cache) {
+    ccache_stats stats = { 0, 0, 0 };
+    if (cache != NULL) {
+        stats = cache->stats;
+    }
+
+    return stats;
+}
+
+void fscl_cache_reset_stats(ccache* cache) {
+    if (cache == NULL) {
+        return;
+    }
+
+    cache->stats.hits = 0;
+    cache->stats.misses = 0;
+    cache->stats.evictions = 0;
+}
+
+size_t fscl_cache_size(const ccache* cache) {
+    if (cache == NULL) {
+        return 0;
+    }
+
+    return cache->size;
+}
+
+size_t fscl_cache_capacity(const ccache* cache) {
+    if (cache == NULL) {
+        return 0;
+    }
+
+    return cache->capacity;
+}
+
+bool fscl_cache_not_empty(const ccache* cache) {
+    return cache != NULL && cache->size > 0;
+}
+
+bool fscl_cache_not_cnullptr(const ccache* cache) {
+    return cache != NULL;
+}
+
+bool fscl_cache_is_empty(const ccache* cache) {
+    return cache == NULL || cache->size == 0;
+}
+
+bool fscl_cache_is_cnullptr(const ccache* cache) {
+    return cache == NULL;
+}
@@ -0,0 +1,160 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L // Thread-specific data under strict ISO C
+#endif
+#include <stdbool.h>
+#include <stdlib.h>
+#include "xthread.h"
+
+// Per-thread announcement. Records are kept on a global list and reused by
+// later threads once their owner exits, so they are never freed.
+struct fscl_epoch_record {
+    volatile uint64_t active;        // Epoch the owner is reading in, 0 when quiescent
+    struct fscl_epoch_record* next;  // Next record on the global list
+    size_t depth;                    // Nesting of the owner's critical sections
+    bool in_use;                     // Owned by a live thread, guarded by fscl_epoch_lock
+    unsigned char padding[FSCL_CACHE_LINE]; // Keeps announcements of different threads apart
+};
+
+// Epoch 0 is reserved for quiescent records
+static volatile uint64_t fscl_epoch_global = 1;
+static fscl_rwlock fscl_epoch_lock = FSCL_RWLOCK_INIT;
+static struct fscl_epoch_record* fscl_epoch_records = NULL;
+static FSCL_THREAD_LOCAL struct fscl_epoch_record* fscl_epoch_local = NULL;
+
+// Thread-exit hook handing the record of the exiting thread back to the list
+static bool fscl_epoch_hooked = false;
+#if defined(_WIN32)
+static DWORD fscl_epoch_key;
+#else
+static pthread_key_t fscl_epoch_key;
+#endif
+
+// Helper function to release the record of a thread that is exiting
+static void fscl_epoch_release(struct fscl_epoch_record* record) {
+    if (record == NULL) {
+        return;
+    }
+
+    fscl_rwlock_write_lock(&fscl_epoch_lock);
+    fscl_atomic_store_u64(&record->active, 0);
+    record->depth = 0;
+    record->in_use = false;
+    fscl_rwlock_write_unlock(&fscl_epoch_lock);
+
+    fscl_epoch_local = NULL;
+}
+
+#if defined(_WIN32)
+static void WINAPI fscl_epoch_thread_exit(void* record) {
+    fscl_epoch_release((struct fscl_epoch_record*)record);
+}
+#else
+static void fscl_epoch_thread_exit(void* record) {
+    fscl_epoch_release((struct fscl_epoch_record*)record);
+}
+#endif
+
+// Helper function to give the calling thread a record, reusing a free one
+static struct fscl_epoch_record* fscl_epoch_register(void) {
+    fscl_rwlock_write_lock(&fscl_epoch_lock);
+
+    if (!fscl_epoch_hooked) {
+#if defined(_WIN32)
+        fscl_epoch_key = FlsAlloc(fscl_epoch_thread_exit);
+        fscl_epoch_hooked = fscl_epoch_key != FLS_OUT_OF_INDEXES;
+#else
+        fscl_epoch_hooked = pthread_key_create(&fscl_epoch_key, fscl_epoch_thread_exit) == 0;
+#endif
+    }
+
+    struct fscl_epoch_record* record = fscl_epoch_records;
+    while (record != NULL && record->in_use) {
+        record = record->next;
+    }
+
+    if (record == NULL) {
+        record = (struct fscl_epoch_record*)malloc(sizeof(struct fscl_epoch_record));
+        if (record != NULL) {
+            record->active = 0;
+            record->depth = 0;
+            record->next = fscl_epoch_records;
+            fscl_epoch_records = record;
+        }
+    }
+
+    if (record != NULL) {
+        record->in_use = true;
+        if (fscl_epoch_hooked) {
+#if defined(_WIN32)
+            FlsSetValue(fscl_epoch_key, record);
+#else
+            pthread_setspecific(fscl_epoch_key, record);
+#endif
+        }
+    }
+
+    fscl_rwlock_write_unlock(&fscl_epoch_lock);
+
+    fscl_epoch_local = record;
+    return record;
+}
+
+fscl_epoch_record* fscl_epoch_enter(void) {
+    struct fscl_epoch_record* record = fscl_epoch_local;
+    if (record == NULL) {
+        record = fscl_epoch_register();
+        if (record == NULL) {
+            return NULL;
+        }
+    }
+
+    // Nested sections stay in the epoch of the outermost one
+    if (record->depth++ > 0) {
+        return record;
+    }
+
+    // The fence orders the announcement before every read that follows, so
+    // a writer scanning the records after unlinking memory sees it
+    fscl_atomic_store_u64(&record->active, fscl_atomic_load_u64(&fscl_epoch_global));
+    fscl_atomic_fence();
+
+    return record;
+}
+
+void fscl_epoch_exit(fscl_epoch_record* record) {
+    if (record != NULL && --record->depth == 0) {
+        fscl_atomic_store_u64(&record->active, 0);
+    }
+}
+
+uint64_t fscl_epoch_advance(void) {
+    return fscl_atomic_fetch_add_u64(&fscl_epoch_global, 1);
+}
+
+uint64_t fscl_epoch_oldest(void) {
+    uint64_t oldest = UINT64_MAX;
+
+    fscl_atomic_fence();
+    fscl_rwlock_read_lock(&fscl_epoch_lock);
+    for (struct fscl_epoch_record* record = fscl_epoch_records; record != NULL; record = record->next) {
+        uint64_t active = fscl_atomic_load_u64(&record->active);
+        if (active != 0 && active < oldest) {
+            oldest = active;
+        }
+    }
+    fscl_rwlock_read_unlock(&fscl_epoch_lock);
+
+    return oldest;
+}
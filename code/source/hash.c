@@ -0,0 +1,207 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/xstructures/hash.h"
+#include <string.h>
+
+#if !defined(__SIZEOF_INT128__) && defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+// wyhash secret constants
+static const uint64_t fscl_hash_secret[4] = {
+    0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL,
+    0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL
+};
+
+// =======================
+// MIXING HELPERS
+// =======================
+
+// Helper function to compute the full 128-bit product of a and b in place
+static inline void fscl_hash_mum(uint64_t* a, uint64_t* b) {
+#if defined(__SIZEOF_INT128__)
+    __uint128_t product = (__uint128_t)*a * *b;
+    *a = (uint64_t)product;
+    *b = (uint64_t)(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    *a = _umul128(*a, *b, b);
+#else
+    uint64_t ha = *a >> 32, hb = *b >> 32, la = (uint32_t)*a, lb = (uint32_t)*b;
+    uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    uint64_t t = rl + (rm0 << 32), carry = t < rl;
+    uint64_t lo = t + (rm1 << 32);
+    carry += lo < t;
+    *a = lo;
+    *b = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+#endif
+}
+
+// Helper function to fold a 128-bit product into 64 bits
+static inline uint64_t fscl_hash_mix(uint64_t a, uint64_t b) {
+    fscl_hash_mum(&a, &b);
+    return a ^ b;
+}
+
+static inline uint64_t fscl_hash_read8(const uint8_t* p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint64_t fscl_hash_read4(const uint8_t* p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint64_t fscl_hash_read3(const uint8_t* p, size_t k) {
+    return ((uint64_t)p[0] << 16) | ((uint64_t)p[k >> 1] << 8) | p[k - 1];
+}
+
+// Helper function to give each value type its own hash stream
+static inline uint64_t fscl_hash_type_seed(ctofu_type type, uint64_t seed) {
+    return seed ^ ((uint64_t)type * 0x9e3779b97f4a7c15ULL);
+}
+
+// =======================
+// HASH FUNCTIONS
+// =======================
+
+uint64_t fscl_tofu_hash_uint(uint64_t value, uint64_t seed) {
+    return fscl_hash_mix(value ^ fscl_hash_secret[0], seed ^ fscl_hash_secret[1]);
+}
+
+uint64_t fscl_tofu_hash_int(int64_t value, uint64_t seed) {
+    return fscl_tofu_hash_uint((uint64_t)value, seed);
+}
+
+uint64_t fscl_tofu_hash_double(double value, uint64_t seed) {
+    uint64_t bits = 0;
+
+    if (value != value) {
+        bits = 0x7ff8000000000000ULL; // Canonical quiet NaN
+    } else if (value != 0.0) { // Folds -0.0 onto 0.0
+        memcpy(&bits, &value, sizeof(bits));
+    }
+
+    return fscl_tofu_hash_uint(bits, seed);
+}
+
+uint64_t fscl_tofu_hash_bytes(const void* data, size_t length, uint64_t seed) {
+    const uint8_t* p = (const uint8_t*)data;
+    const uint64_t* secret = fscl_hash_secret;
+    uint64_t a, b;
+
+    seed ^= fscl_hash_mix(seed ^ secret[0], secret[1]);
+
+    if (length <= 16) {
+        if (length >= 4) {
+            a = (fscl_hash_read4(p) << 32) | fscl_hash_read4(p + ((length >> 3) << 2));
+            b = (fscl_hash_read4(p + length - 4) << 32) | fscl_hash_read4(p + length - 4 - ((length >> 3) << 2));
+        } else if (length > 0) {
+            a = fscl_hash_read3(p, length);
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+    } else {
+        size_t i = length;
+        if (i >= 48) {
+            // Three independent lanes keep the multipliers busy in parallel
+            uint64_t see1 = seed, see2 = seed;
+            do {
+                seed = fscl_hash_mix(fscl_hash_read8(p) ^ secret[1], fscl_hash_read8(p + 8) ^ seed);
+                see1 = fscl_hash_mix(fscl_hash_read8(p + 16) ^ secret[2], fscl_hash_read8(p + 24) ^ see1);
+                see2 = fscl_hash_mix(fscl_hash_read8(p + 32) ^ secret[3], fscl_hash_read8(p + 40) ^ see2);
+                p += 48;
+                i -= 48;
+            } while (i >= 48);
+            seed ^= see1 ^ see2;
+        }
+        while (i > 16) {
+            seed = fscl_hash_mix(fscl_hash_read8(p) ^ secret[1], fscl_hash_read8(p + 8) ^ seed);
+            i -= 16;
+            p += 16;
+        }
+        a = fscl_hash_read8(p + i - 16);
+        b = fscl_hash_read8(p + i - 8);
+    }
+
+    a ^= secret[1];
+    b ^= seed;
+    fscl_hash_mum(&a, &b);
+
+    return fscl_hash_mix(a ^ secret[0] ^ length, b ^ secret[1]);
+}
+
+uint64_t fscl_tofu_hash_string(const char* string, uint64_t seed) {
+    if (string == NULL) {
+        return fscl_tofu_hash_bytes("", 0, seed);
+    }
+
+    return fscl_tofu_hash_bytes(string, strlen(string), seed);
+}
+
+uint64_t fscl_tofu_hash(const ctofu* value, uint64_t seed) {
+    if (value == NULL) {
+        return fscl_tofu_hash_uint(0, seed);
+    }
+
+    seed = fscl_hash_type_seed(value->type, seed);
+
+    switch (value->type) {
+        case TOFU_INT_TYPE:
+            return fscl_tofu_hash_int(value->data.int_type, seed);
+        case TOFU_UINT_TYPE:
+            return fscl_tofu_hash_uint(value->data.uint_type, seed);
+        case TOFU_OCTAL_TYPE:
+            return fscl_tofu_hash_int(value->data.octal_type, seed);
+        case TOFU_HEX_TYPE:
+            return fscl_tofu_hash_int(value->data.hex_type, seed);
+        case TOFU_BIT_TYPE:
+            return fscl_tofu_hash_int(value->data.bit_type, seed);
+        case TOFU_CHAR_TYPE:
+            return fscl_tofu_hash_uint((unsigned char)value->data.char_type, seed);
+        case TOFU_BOOLEAN_TYPE:
+            return fscl_tofu_hash_uint(value->data.boolean_type ? 1 : 0, seed);
+        case TOFU_FLOAT_TYPE:
+            return fscl_tofu_hash_double(value->data.float_type, seed);
+        case TOFU_DOUBLE_TYPE:
+            return fscl_tofu_hash_double(value->data.double_type, seed);
+        case TOFU_STRING_TYPE:
+            return fscl_tofu_hash_string(value->data.string_type, seed);
+        default:
+            // Payload-less types share one hash; still correct
+            return fscl_tofu_hash_uint(0, seed);
+    }
+}
+
+// =======================
+// CACHED HASH FUNCTIONS
+// =======================
+
+ctofu_hashed fscl_tofu_hashed(ctofu value, uint64_t seed) {
+    ctofu_hashed hashed;
+    hashed.value = value;
+    hashed.hash = fscl_tofu_hash(&value, seed);
+
+    return hashed;
+}
+
+bool fscl_tofu_hashed_equal(const ctofu_hashed* a, const ctofu_hashed* b) {
+    if (a == NULL || b == NULL) {
+        return false;
+    }
+
+    return a->hash == b->hash && fscl_tofu_compare(&a->value, &b->value) == 0;
+}
@@ -10,23 +10,1317 @@ Description:
     feel free to contact Michael at michaelbrockus@gmail.com.
 ==============================================================================
 */
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L // Reader-writer locks under strict ISO C
+#endif
 #include "fossil/xstructures/map.h"
+#include "fossil/xstructures/hash.h"
+#include "xsimd.h"
+#include "xthread.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+// Index slot encoding: the upper 32 bits hold a hash fragment used to reject
+// most candidates without touching the keys, the lower 32 bits hold the
+// entry position plus two so that 0 and 1 can mark empty and deleted slots.
+#define MAP_SLOT_EMPTY      0ULL
+#define MAP_SLOT_DELETED    1ULL
+#define MAP_SLOT_HASH_MASK  0xFFFFFFFF00000000ULL
+#define MAP_SLOT_ENTRY_MASK 0x00000000FFFFFFFFULL
+
+// Control byte encoding for the Swiss layout: a full slot stores the top
+// seven bits of its hash, empty and deleted slots have the high bit set.
+#define MAP_CTRL_EMPTY   0x80
+#define MAP_CTRL_DELETED 0xFE
+
+// Widest group probed at once. The control array repeats its first
+// MAP_GROUP_MAX - 1 bytes past the end so any group can be loaded unaligned.
+#define MAP_GROUP_MAX 32
+
+// SSE2 is part of every x86-64 target, so only AVX2 needs a runtime check
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MAP_HAVE_SSE2 1
+#endif
+
+// Hint that an address is read soon, so a batch of lookups overlaps its
+// cache misses instead of waiting on each in turn
+#if defined(__GNUC__) || defined(__clang__)
+#define MAP_PREFETCH(address) __builtin_prefetch(address)
+#elif defined(MAP_HAVE_SSE2)
+#define MAP_PREFETCH(address) _mm_prefetch((const char*)(address), _MM_HINT_T0)
+#else
+#define MAP_PREFETCH(address) ((void)(address))
+#endif
+
+// Keys hashed and prefetched together by the bulk operations
+#define MAP_BATCH 32
+
+// Maximum load of the index (live entries plus tombstones) before a rebuild
+#define MAP_MAX_LOAD_NUM 3
+#define MAP_MAX_LOAD_DEN 4
+
+// Slots of the old index migrated by each operation during an incremental
+// resize. Growth leaves room for at least 3/8 of the new slot count in
+// inserts, so any step above 2 finishes before the next resize is due.
+#define MAP_MIGRATE_STEP 64
+
+#define MAP_NOT_FOUND ((size_t)-1)
+
+// Hash bits that pick the shard of a concurrent map. They sit between the
+// low bits used for the slot position and the top bits kept as tags.
+#define MAP_SHARD_SHIFT 40
+
+// Largest number of shards a concurrent map can be split into
+#define MAP_MAX_SHARDS 4096
+
+// Frozen maps group keys into buckets of this many on average and search a
+// hash seed per bucket that sends all of its keys to free slots. Buckets
+// holding one key store their slot directly, marked by the top bit. Larger
+// buckets save displacement memory, but the last multi-key buckets then
+// meet a nearly full table and the search slows down sharply.
+#define MAP_FROZEN_BUCKET_KEYS 2
+#define MAP_FROZEN_DIRECT 0x80000000u
+#define MAP_FROZEN_MAX_SEEDS (1u << 20)
+#define MAP_FROZEN_ATTEMPTS 8
+
+// Published pairs of a read-mostly shard. Once a writer replaces it, it
+// waits on the retired list until no reader is left in the epoch it was
+// replaced in.
+struct cmap_snapshot {
+    cmap map;
+    uint64_t epoch;
+    struct cmap_snapshot* next;
+};
+
+// One independently locked part of a concurrent map. The padding keeps the
+// lock of a shard off the cache line holding its neighbour's lock.
+// Read-mostly maps keep their pairs in an immutable snapshot instead of in
+// map: readers load it without locking, and writers publish a modified copy.
+struct cmap_shard {
+    fscl_rwlock lock;
+    cmap map;
+    struct cmap_snapshot* snapshot;
+    struct cmap_snapshot* retired;
+    unsigned char padding[FSCL_CACHE_LINE];
+};
+
+// =======================
+// GROUP MATCHING
+// =======================
+
+// Matches a run of control bytes at once; bit i of a mask describes byte i
+struct cmap_group {
+    size_t width;
+    uint32_t (*match)(const uint8_t* ctrl, uint8_t tag, uint32_t* empty);
+    uint32_t (*match_free)(const uint8_t* ctrl);
+};
+
+#if !defined(MAP_HAVE_SSE2)
+static uint32_t fscl_map_group_match_scalar(const uint8_t* ctrl, uint8_t tag, uint32_t* empty) {
+    uint32_t match = 0;
+    uint32_t vacant = 0;
+    for (unsigned i = 0; i < 8; ++i) {
+        match |= (uint32_t)(ctrl[i] == tag) << i;
+        vacant |= (uint32_t)(ctrl[i] == MAP_CTRL_EMPTY) << i;
+    }
+
+    *empty = vacant;
+    return match;
+}
+
+static uint32_t fscl_map_group_free_scalar(const uint8_t* ctrl) {
+    uint32_t vacant = 0;
+    for (unsigned i = 0; i < 8; ++i) {
+        vacant |= (uint32_t)(ctrl[i] >> 7) << i;
+    }
+
+    return vacant;
+}
+
+static const struct cmap_group fscl_map_group_scalar = {
+    8, fscl_map_group_match_scalar, fscl_map_group_free_scalar
+};
+#endif
+
+#if defined(MAP_HAVE_SSE2)
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+static uint32_t fscl_map_group_match_sse2(const uint8_t* ctrl, uint8_t tag, uint32_t* empty) {
+    __m128i group = _mm_loadu_si128((const __m128i*)ctrl);
+
+    *empty = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)MAP_CTRL_EMPTY)));
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)tag)));
+}
+
+static uint32_t fscl_map_group_free_sse2(const uint8_t* ctrl) {
+    // Empty and deleted bytes are exactly the ones with the sign bit set
+    return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)ctrl));
+}
+
+static const struct cmap_group fscl_map_group_sse2 = {
+    16, fscl_map_group_match_sse2, fscl_map_group_free_sse2
+};
+
+#if defined(__GNUC__) || defined(__clang__)
+#define MAP_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define MAP_TARGET_AVX2
+#endif
+
+MAP_TARGET_AVX2 static uint32_t fscl_map_group_match_avx2(const uint8_t* ctrl, uint8_t tag, uint32_t* empty) {
+    __m256i group = _mm256_loadu_si256((const __m256i*)ctrl);
+
+    *empty = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(group, _mm256_set1_epi8((char)MAP_CTRL_EMPTY)));
+    return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(group, _mm256_set1_epi8((char)tag)));
+}
+
+MAP_TARGET_AVX2 static uint32_t fscl_map_group_free_avx2(const uint8_t* ctrl) {
+    return (uint32_t)_mm256_movemask_epi8(_mm256_loadu_si256((const __m256i*)ctrl));
+}
+
+static const struct cmap_group fscl_map_group_avx2 = {
+    32, fscl_map_group_match_avx2, fscl_map_group_free_avx2
+};
+#endif
+
+// Helper function to pick the widest group matcher this CPU runs
+static const struct cmap_group* fscl_map_group_select(void) {
+#if defined(MAP_HAVE_SSE2)
+    if (fscl_simd_has_avx2()) {
+        return &fscl_map_group_avx2;
+    }
+    return &fscl_map_group_sse2;
+#else
+    return &fscl_map_group_scalar;
+#endif
+}
+
+// Helper function to get the position of the lowest set bit
+static unsigned fscl_map_lowest_bit(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned)__builtin_ctz(mask);
+#elif defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return (unsigned)index;
+#else
+    unsigned index = 0;
+    while ((mask & 1u) == 0) {
+        mask >>= 1;
+        index++;
+    }
+    return index;
+#endif
+}
+
+// =======================
+// INDEX HELPERS
+// =======================
+
+static uint64_t fscl_map_slot_make(uint64_t hash, size_t entry) {
+    return (hash & MAP_SLOT_HASH_MASK) | (uint64_t)(entry + 2);
+}
+
+static size_t fscl_map_slot_entry(uint64_t slot) {
+    return (size_t)(slot & MAP_SLOT_ENTRY_MASK) - 2;
+}
+
+static bool fscl_map_slot_full(uint64_t slot) {
+    return slot > MAP_SLOT_DELETED;
+}
+
+static uint8_t fscl_map_ctrl_tag(uint64_t hash) {
+    return (uint8_t)(hash >> 57);
+}
+
+// Helper function to write a control byte and its mirror past the end
+static void fscl_map_ctrl_set(cmap_index* index, size_t pos, uint8_t ctrl) {
+    index->ctrl[pos] = ctrl;
+    if (pos < MAP_GROUP_MAX - 1) {
+        index->ctrl[index->count + pos] = ctrl;
+    }
+}
+
+// Helper function to read the entry position stored in a full slot
+static size_t fscl_map_index_entry(const cmap_index* index, size_t pos) {
+    if (index->group != NULL) {
+        return index->entries[pos];
+    }
+
+    return fscl_map_slot_entry(index->slots[pos]);
+}
+
+// Helper function to probe a Swiss index group by group for key
+static size_t fscl_map_swiss_find(const cmap* map, const cmap_index* index, const ctofu* key, uint64_t hash, size_t* vacancy) {
+    const struct cmap_group* group = index->group;
+    const size_t mask = index->count - 1;
+    const uint8_t tag = fscl_map_ctrl_tag(hash);
+
+    for (size_t pos = (size_t)hash & mask, probed = 0; probed < index->count; pos = (pos + group->width) & mask, probed += group->width) {
+        uint32_t empty;
+        uint32_t match = group->match(index->ctrl + pos, tag, &empty);
+
+        if (vacancy != NULL && *vacancy == MAP_NOT_FOUND) {
+            uint32_t vacant = group->match_free(index->ctrl + pos);
+            if (vacant != 0) {
+                *vacancy = (pos + fscl_map_lowest_bit(vacant)) & mask;
+            }
+        }
+
+        // Only tag matches reach the full key comparison
+        while (match != 0) {
+            size_t candidate = (pos + fscl_map_lowest_bit(match)) & mask;
+            if (fscl_tofu_compare(&map->keys[index->entries[candidate]], key) == 0) {
+                return candidate;
+            }
+            match &= match - 1;
+        }
+
+        if (empty != 0) {
+            return MAP_NOT_FOUND;
+        }
+    }
+
+    return MAP_NOT_FOUND;
+}
+
+// Helper function to find the slot holding key, or MAP_NOT_FOUND. When
+// vacancy is given, the first free slot on the probe path is stored there
+// so a following insert of the same key can skip probing again.
+static size_t fscl_map_index_find(const cmap* map, const cmap_index* index, const ctofu* key, uint64_t hash, size_t* vacancy) {
+    if (vacancy != NULL) {
+        *vacancy = MAP_NOT_FOUND;
+    }
+
+    if (index->count == 0) {
+        return MAP_NOT_FOUND;
+    }
+
+    if (index->group != NULL) {
+        return fscl_map_swiss_find(map, index, key, hash, vacancy);
+    }
+
+    const size_t mask = index->count - 1;
+    const uint64_t fragment = hash & MAP_SLOT_HASH_MASK;
+
+    for (size_t pos = (size_t)hash & mask;; pos = (pos + 1) & mask) {
+        uint64_t slot = index->slots[pos];
+        if (!fscl_map_slot_full(slot) && vacancy != NULL && *vacancy == MAP_NOT_FOUND) {
+            *vacancy = pos;
+        }
+
+        if (slot == MAP_SLOT_EMPTY) {
+            return MAP_NOT_FOUND;
+        }
+
+        if (fscl_map_slot_full(slot) && (slot & MAP_SLOT_HASH_MASK) == fragment) {
+            size_t entry = fscl_map_slot_entry(slot);
+            if (fscl_tofu_compare(&map->keys[entry], key) == 0) {
+                return pos;
+            }
+        }
+    }
+}
+
+// Helper function to find the slot pointing at a known entry position
+static size_t fscl_map_index_find_entry(const cmap_index* index, uint64_t hash, size_t entry) {
+    if (index->count == 0) {
+        return MAP_NOT_FOUND;
+    }
+
+    const size_t mask = index->count - 1;
+
+    if (index->group != NULL) {
+        const uint8_t tag = fscl_map_ctrl_tag(hash);
+        for (size_t pos = (size_t)hash & mask;; pos = (pos + 1) & mask) {
+            if (index->ctrl[pos] == tag && index->entries[pos] == entry) {
+                return pos;
+            }
+            if (index->ctrl[pos] == MAP_CTRL_EMPTY) {
+                return MAP_NOT_FOUND;
+            }
+        }
+    }
+
+    const uint64_t wanted = fscl_map_slot_make(hash, entry);
+    for (size_t pos = (size_t)hash & mask;; pos = (pos + 1) & mask) {
+        uint64_t slot = index->slots[pos];
+        if (slot == wanted) {
+            return pos;
+        }
+        if (slot == MAP_SLOT_EMPTY) {
+            return MAP_NOT_FOUND;
+        }
+    }
+}
+
+// Helper function to point a full slot at a different entry position
+static void fscl_map_index_retarget(cmap_index* index, size_t pos, uint64_t hash, size_t entry) {
+    if (index->group != NULL) {
+        index->entries[pos] = (uint32_t)entry;
+    } else {
+        index->slots[pos] = fscl_map_slot_make(hash, entry);
+    }
+}
+
+// Helper function to store an entry position in a known free slot
+static void fscl_map_index_place_at(cmap_index* index, size_t pos, uint64_t hash, size_t entry) {
+    if (index->group != NULL) {
+        if (index->ctrl[pos] == MAP_CTRL_DELETED) {
+            index->tombstones--;
+        }
+        fscl_map_ctrl_set(index, pos, fscl_map_ctrl_tag(hash));
+        index->entries[pos] = (uint32_t)entry;
+        return;
+    }
+
+    if (index->slots[pos] == MAP_SLOT_DELETED) {
+        index->tombstones--;
+    }
+    index->slots[pos] = fscl_map_slot_make(hash, entry);
+}
+
+// Helper function to check that a slot holds no entry
+static bool fscl_map_index_slot_free(const cmap_index* index, size_t pos) {
+    return index->group != NULL ? index->ctrl[pos] >= MAP_CTRL_EMPTY : !fscl_map_slot_full(index->slots[pos]);
+}
+
+// Helper function to store an entry position in the first free slot
+static void fscl_map_index_place(cmap_index* index, uint64_t hash, size_t entry) {
+    const size_t mask = index->count - 1;
+    size_t pos = (size_t)hash & mask;
+
+    if (index->group != NULL) {
+        const struct cmap_group* group = index->group;
+        for (;; pos = (pos + group->width) & mask) {
+            uint32_t vacant = group->match_free(index->ctrl + pos);
+            if (vacant != 0) {
+                pos = (pos + fscl_map_lowest_bit(vacant)) & mask;
+                break;
+            }
+        }
+    } else {
+        while (fscl_map_slot_full(index->slots[pos])) {
+            pos = (pos + 1) & mask;
+        }
+    }
+
+    fscl_map_index_place_at(index, pos, hash, entry);
+}
+
+// Helper function to release a slot, leaving a tombstone only when needed
+static void fscl_map_index_release(cmap_index* index, size_t pos) {
+    const size_t next = (pos + 1) & (index->count - 1);
+
+    // A probe chain can only run through pos if the following slot is in use
+    if (index->group != NULL) {
+        if (index->ctrl[next] == MAP_CTRL_EMPTY) {
+            fscl_map_ctrl_set(index, pos, MAP_CTRL_EMPTY);
+        } else {
+            fscl_map_ctrl_set(index, pos, MAP_CTRL_DELETED);
+            index->tombstones++;
+        }
+        return;
+    }
+
+    if (index->slots[next] == MAP_SLOT_EMPTY) {
+        index->slots[pos] = MAP_SLOT_EMPTY;
+    } else {
+        index->slots[pos] = MAP_SLOT_DELETED;
+        index->tombstones++;
+    }
+}
+
+// Helper function to allocate an empty index with the layout of the given one
+static ctofu_error fscl_map_index_alloc(cmap_index* index, const cmap_index* layout, size_t count) {
+    index->slots = NULL;
+    index->ctrl = NULL;
+    index->entries = NULL;
+    index->group = layout->group;
+    index->count = count;
+    index->tombstones = 0;
+
+    if (index->group != NULL) {
+        index->ctrl = (uint8_t*)malloc(count + MAP_GROUP_MAX - 1);
+        index->entries = (uint32_t*)malloc(count * sizeof(uint32_t));
+        if (index->ctrl == NULL || index->entries == NULL) {
+            free(index->ctrl);
+            free(index->entries);
+            index->ctrl = NULL;
+            index->entries = NULL;
+            return fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+        }
+        memset(index->ctrl, MAP_CTRL_EMPTY, count + MAP_GROUP_MAX - 1);
+    } else {
+        index->slots = (uint64_t*)calloc(count, sizeof(uint64_t));
+        if (index->slots == NULL) {
+            return fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+        }
+    }
+
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+static void fscl_map_index_free(cmap_index* index) {
+    free(index->slots);
+    free(index->ctrl);
+    free(index->entries);
+    index->slots = NULL;
+    index->ctrl = NULL;
+    index->entries = NULL;
+    index->count = 0;
+    index->tombstones = 0;
+}
+
+// Helper function to rebuild the index with the given number of slots
+static ctofu_error fscl_map_index_rebuild(cmap* map, size_t count) {
+    cmap_index index;
+    ctofu_error result = fscl_map_index_alloc(&index, &map->index, count);
+    if (result != TOFU_SUCCESS) {
+        return result;
+    }
+
+    // Cached hashes make the rebuild free of key hashing and comparisons
+    for (size_t i = 0; i < map->size; ++i) {
+        fscl_map_index_place(&index, map->hashes[i], i);
+    }
+
+    fscl_map_index_free(&map->index);
+    map->index = index;
+
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+// Helper function to pick the smallest index that keeps size entries at half load
+static size_t fscl_map_index_count_for(const cmap_index* index, size_t size) {
+    size_t count = index->group != NULL ? MAP_GROUP_MAX : MAP_INITIAL_SLOTS;
+    while (count / 2 < size) {
+        count *= 2;
+    }
+    return count;
+}
+
+// Helper function to grow the dense arrays to hold at least needed entries.
+// Growth moves every pair, even when the index itself resizes incrementally.
+static ctofu_error fscl_map_reserve_entries(cmap* map, size_t needed) {
+    if (needed <= map->capacity) {
+        return fscl_tofu_error(TOFU_SUCCESS);
+    }
+
+    size_t capacity = map->capacity == 0 ? MAP_INITIAL_SLOTS / 2 : map->capacity;
+    while (capacity < needed) {
+        capacity *= 2;
+    }
+
+    // One key past the capacity holds the end marker read by the iterators
+    ctofu* keys = (ctofu*)realloc(map->keys, (capacity + 1) * sizeof(ctofu));
+    if (keys == NULL) {
+        return fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+    }
+    map->keys = keys;
+
+    ctofu* values = (ctofu*)realloc(map->values, capacity * sizeof(ctofu));
+    if (values == NULL) {
+        return fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+    }
+    map->values = values;
+
+    uint64_t* hashes = (uint64_t*)realloc(map->hashes, capacity * sizeof(uint64_t));
+    if (hashes == NULL) {
+        return fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+    }
+    map->hashes = hashes;
+
+    map->capacity = capacity;
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+// Helper function to mark the key after the last pair, where iterators stop
+static void fscl_map_mark_end(cmap* map) {
+    if (map->keys != NULL) {
+        map->keys[map->size].type = TOFU_INVALID_TYPE;
+    }
+}
+
+// Helper function to move up to limit slots of the old index into the live one
+static void fscl_map_migrate(cmap* map, size_t limit) {
+    cmap_index* old = &map->old_index;
+    if (old->count == 0) {
+        return;
+    }
+
+    size_t end = map->migrate_pos + limit;
+    if (end > old->count || end < map->migrate_pos) {
+        end = old->count;
+    }
+
+    for (size_t pos = map->migrate_pos; pos < end; ++pos) {
+        bool full = old->group != NULL ? old->ctrl[pos] < MAP_CTRL_EMPTY : fscl_map_slot_full(old->slots[pos]);
+        if (full) {
+            size_t entry = fscl_map_index_entry(old, pos);
+            fscl_map_index_place(&map->index, map->hashes[entry], entry);
+            fscl_map_index_release(old, pos);
+        }
+    }
+
+    map->migrate_pos = end;
+    if (map->migrate_pos == old->count) {
+        fscl_map_index_free(old);
+        map->migrate_pos = 0;
+    }
+}
+
+// Helper function to swap in a larger index and drain the old one over time
+static ctofu_error fscl_map_index_begin_resize(cmap* map, size_t count) {
+    // A resize still in flight is finished before the next one starts
+    fscl_map_migrate(map, SIZE_MAX);
+
+    cmap_index index;
+    ctofu_error result = fscl_map_index_alloc(&index, &map->index, count);
+    if (result != TOFU_SUCCESS) {
+        return result;
+    }
+
+    map->old_index = map->index;
+    map->index = index;
+    map->migrate_pos = 0;
+    fscl_map_migrate(map, MAP_MIGRATE_STEP);
+
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+// Helper function to make sure one more entry fits without overloading the index
+static ctofu_error fscl_map_make_room(cmap* map) {
+    if (map->size >= MAP_MAX_SIZE) {
+        return fscl_tofu_error(TOFU_WAS_BAD_RANGE); // Map is full
+    }
+
+    ctofu_error result = fscl_map_reserve_entries(map, map->size + 1);
+    if (result != TOFU_SUCCESS) {
+        return result;
+    }
+
+    const size_t load = map->size + map->index.tombstones + 1;
+    if (map->index.count == 0 || load * MAP_MAX_LOAD_DEN > map->index.count * MAP_MAX_LOAD_NUM) {
+        // Grows when live entries dominate, otherwise only sweeps tombstones
+        size_t count = fscl_map_index_count_for(&map->index, map->size + 1);
+        if (map->incremental && map->index.count != 0) {
+            return fscl_map_index_begin_resize(map, count);
+        }
+        fscl_map_migrate(map, SIZE_MAX);
+        return fscl_map_index_rebuild(map, count);
+    }
+
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+// Helper function to find the dense position of key, or MAP_NOT_FOUND,
+// optionally noting the free slot of the live index the key would take
+static size_t fscl_map_probe(const cmap* map, const ctofu* key, uint64_t hash, size_t* vacancy) {
+    size_t pos = fscl_map_index_find(map, &map->index, key, hash, vacancy);
+    if (pos != MAP_NOT_FOUND) {
+        return fscl_map_index_entry(&map->index, pos);
+    }
+
+    // Keys not yet migrated by an incremental resize are still in the old index
+    pos = fscl_map_index_find(map, &map->old_index, key, hash, NULL);
+    if (pos != MAP_NOT_FOUND) {
+        return fscl_map_index_entry(&map->old_index, pos);
+    }
+
+    return MAP_NOT_FOUND;
+}
+
+// Helper function to find the dense position of key, or MAP_NOT_FOUND
+static size_t fscl_map_lookup(const cmap* map, const ctofu* key, uint64_t hash) {
+    return fscl_map_probe(map, key, hash, NULL);
+}
+
+// Helper function to append a key that fscl_map_probe did not find. The
+// vacancy it reported is reused unless making room replaced the index or
+// a migration since the probe filled that slot.
+static ctofu_error fscl_map_append(cmap* map, const ctofu* key, const ctofu* value, uint64_t hash, size_t vacancy, size_t* position) {
+    const void* storage = map->index.group != NULL ? (const void*)map->index.ctrl : (const void*)map->index.slots;
+
+    ctofu_error result = fscl_map_make_room(map);
+    if (result != TOFU_SUCCESS) {
+        return result;
+    }
+
+    size_t entry = map->size++;
+    map->keys[entry] = *key;
+    map->values[entry] = *value;
+    map->hashes[entry] = hash;
+    fscl_map_mark_end(map);
+
+    const void* current = map->index.group != NULL ? (const void*)map->index.ctrl : (const void*)map->index.slots;
+    if (vacancy != MAP_NOT_FOUND && current == storage && fscl_map_index_slot_free(&map->index, vacancy)) {
+        fscl_map_index_place_at(&map->index, vacancy, hash, entry);
+    } else {
+        fscl_map_index_place(&map->index, hash, entry);
+    }
+
+    if (position != NULL) {
+        *position = entry;
+    }
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+// Helper function to remove the entry referenced by a slot of either index
+static void fscl_map_remove_slot(cmap* map, cmap_index* index, size_t pos) {
+    size_t entry = fscl_map_index_entry(index, pos);
+    size_t last = map->size - 1;
+
+    fscl_map_index_release(index, pos);
+
+    // Keep the dense arrays packed by moving the last entry into the hole
+    if (entry != last) {
+        cmap_index* holder = &map->index;
+        size_t moved = fscl_map_index_find_entry(holder, map->hashes[last], last);
+        if (moved == MAP_NOT_FOUND) {
+            holder = &map->old_index;
+            moved = fscl_map_index_find_entry(holder, map->hashes[last], last);
+        }
+        fscl_map_index_retarget(holder, moved, map->hashes[last], entry);
+
+        map->keys[entry] = map->keys[last];
+        map->values[entry] = map->values[last];
+        map->hashes[entry] = map->hashes[last];
+    }
+
+    map->size--;
+    fscl_map_mark_end(map);
+}
+
+
+// Helper function to put a map in the empty state; storage is allocated
+// on the first insert
+static void fscl_map_init(cmap* map, const struct cmap_group* group) {
+    map->keys = NULL;
+    map->values = NULL;
+    map->hashes = NULL;
+    map->size = 0;
+    map->capacity = 0;
+    map->index.slots = NULL;
+    map->index.ctrl = NULL;
+    map->index.entries = NULL;
+    map->index.group = group;
+    map->index.count = 0;
+    map->index.tombstones = 0;
+    map->old_index = map->index;
+    map->migrate_pos = 0;
+    map->incremental = false;
+    map->shards = NULL;
+    map->shard_count = 0;
+    map->read_mostly = false;
+}
+
+// Helper function to free the storage owned by a map, but not the map itself
+static void fscl_map_release(cmap* map) {
+    free(map->keys);
+    free(map->values);
+    free(map->hashes);
+    fscl_map_index_free(&map->index);
+    fscl_map_index_free(&map->old_index);
+}
+
+// =======================
+// SHARD HELPERS
+// =======================
+
+// Signature shared by the write operations below, applied to one plain map
+typedef ctofu_error (*fscl_map_write_fn)(cmap* map, const ctofu* key, const ctofu* value, uint64_t hash);
+
+// Helper function to pick the shard owning a hash
+static struct cmap_shard* fscl_map_shard(const cmap* map, uint64_t hash) {
+    return &map->shards[(hash >> MAP_SHARD_SHIFT) & (map->shard_count - 1)];
+}
+
+static ctofu_error fscl_map_insert_hashed(cmap* map, const ctofu* key, const ctofu* value, uint64_t hash) {
+    fscl_map_migrate(map, MAP_MIGRATE_STEP);
+
+    // Check if the key already exists
+    size_t vacancy;
+    if (fscl_map_probe(map, key, hash, &vacancy) != MAP_NOT_FOUND) {
+        return fscl_tofu_error(TOFU_WAS_MISMATCH); // Duplicate key
+    }
+
+    return fscl_map_append(map, key, value, hash, vacancy, NULL);
+}
+
+static ctofu_error fscl_map_remove_hashed(cmap* map, const ctofu* key, const ctofu* value, uint64_t hash) {
+    (void)value; // Removal only needs the key
+    fscl_map_migrate(map, MAP_MIGRATE_STEP);
+
+    cmap_index* index = &map->index;
+    size_t pos = fscl_map_index_find(map, index, key, hash, NULL);
+    if (pos == MAP_NOT_FOUND) {
+        index = &map->old_index;
+        pos = fscl_map_index_find(map, index, key, hash, NULL);
+    }
+
+    if (pos == MAP_NOT_FOUND) {
+        return fscl_tofu_error(TOFU_NOT_FOUND); // Key not found
+    }
+
+    fscl_map_remove_slot(map, index, pos);
+
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+static ctofu_error fscl_map_setter_hashed(cmap* map, const ctofu* key, const ctofu* value, uint64_t hash) {
+    fscl_map_migrate(map, MAP_MIGRATE_STEP);
+    size_t entry = fscl_map_lookup(map, key, hash);
+    if (entry == MAP_NOT_FOUND) {
+        return fscl_tofu_error(TOFU_NOT_FOUND); // Key not found
+    }
+
+    // Found, update the value
+    map->values[entry] = *value;
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+static ctofu_error fscl_map_upsert_hashed(cmap* map, const ctofu* key, const ctofu* value, uint64_t hash) {
+    fscl_map_migrate(map, MAP_MIGRATE_STEP);
+
+    size_t vacancy;
+    size_t entry = fscl_map_probe(map, key, hash, &vacancy);
+    if (entry != MAP_NOT_FOUND) {
+        map->values[entry] = *value;
+        return fscl_tofu_error(TOFU_SUCCESS);
+    }
+
+    return fscl_map_append(map, key, value, hash, vacancy, NULL);
+}
+
+// Helper function to allocate a snapshot holding a copy of the pairs of
+// map, with room for one more so a write rarely has to grow it again
+static struct cmap_snapshot* fscl_map_snapshot_copy(const cmap* map) {
+    struct cmap_snapshot* snapshot = (struct cmap_snapshot*)malloc(sizeof(struct cmap_snapshot));
+    if (snapshot == NULL) {
+        return NULL;
+    }
+
+    cmap* copy = &snapshot->map;
+    fscl_map_init(copy, NULL);
+    snapshot->epoch = 0;
+    snapshot->next = NULL;
+
+    if (map == NULL || map->size == 0) {
+        return snapshot;
+    }
+
+    if (fscl_map_reserve_entries(copy, map->size + 1) != TOFU_SUCCESS ||
+        fscl_map_index_alloc(&copy->index, &map->index, map->index.count) != TOFU_SUCCESS) {
+        fscl_map_release(copy);
+        free(snapshot);
+        return NULL;
+    }
+
+    memcpy(copy->keys, map->keys, map->size * sizeof(ctofu));
+    memcpy(copy->values, map->values, map->size * sizeof(ctofu));
+    memcpy(copy->hashes, map->hashes, map->size * sizeof(uint64_t));
+    if (map->index.group != NULL) {
+        memcpy(copy->index.ctrl, map->index.ctrl, map->index.count + MAP_GROUP_MAX - 1);
+        memcpy(copy->index.entries, map->index.entries, map->index.count * sizeof(uint32_t));
+    } else {
+        memcpy(copy->index.slots, map->index.slots, map->index.count * sizeof(uint64_t));
+    }
+    copy->index.tombstones = map->index.tombstones;
+    copy->size = map->size;
+    fscl_map_mark_end(copy);
+
+    return snapshot;
+}
+
+static void fscl_map_snapshot_free(struct cmap_snapshot* snapshot) {
+    if (snapshot != NULL) {
+        fscl_map_release(&snapshot->map);
+        free(snapshot);
+    }
+}
+
+// Helper function to free the retired snapshots of a shard that no reader
+// can still be looking at
+static void fscl_map_reclaim(struct cmap_shard* shard) {
+    if (shard->retired == NULL) {
+        return;
+    }
+
+    uint64_t oldest = fscl_epoch_oldest();
+    struct cmap_snapshot** link = &shard->retired;
+    while (*link != NULL) {
+        struct cmap_snapshot* snapshot = *link;
+        if (snapshot->epoch < oldest) {
+            *link = snapshot->next;
+            fscl_map_snapshot_free(snapshot);
+        } else {
+            link = &snapshot->next;
+        }
+    }
+}
+
+// Helper function to swap in a modified copy of the snapshot of a shard.
+// The caller holds the shard write lock.
+static void fscl_map_publish(struct cmap_shard* shard, struct cmap_snapshot* copy) {
+    struct cmap_snapshot* current = shard->snapshot;
+
+    // Readers that loaded the old snapshot announced an epoch no later than
+    // the one returned by the advance, which keeps it alive until they leave
+    fscl_atomic_store_ptr((void* volatile*)&shard->snapshot, copy);
+    current->epoch = fscl_epoch_advance();
+    current->next = shard->retired;
+    shard->retired = current;
+
+    fscl_map_reclaim(shard);
+}
+
+// Helper function to apply a write to a copy of the snapshot of a shard and
+// publish the copy. The caller holds the shard write lock.
+static ctofu_error fscl_map_write_snapshot(struct cmap_shard* shard, fscl_map_write_fn write, const ctofu* key, const ctofu* value, uint64_t hash) {
+    struct cmap_snapshot* current = shard->snapshot;
+    struct cmap_snapshot* copy = fscl_map_snapshot_copy(&current->map);
+    if (copy == NULL) {
+        return fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+    }
+
+    ctofu_error result = write(&copy->map, key, value, hash);
+    if (result != TOFU_SUCCESS) {
+        fscl_map_snapshot_free(copy);
+        return result;
+    }
+
+    fscl_map_publish(shard, copy);
+
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+// Helper function to run a write operation, holding the shard write lock
+// when the map is concurrent
+static ctofu_error fscl_map_write(cmap* map, fscl_map_write_fn write, const ctofu* key, const ctofu* value) {
+    uint64_t hash = fscl_tofu_hash(key, TOFU_HASH_SEED);
+    if (map->shards == NULL) {
+        return write(map, key, value, hash);
+    }
+
+    struct cmap_shard* shard = fscl_map_shard(map, hash);
+    fscl_rwlock_write_lock(&shard->lock);
+    ctofu_error result = map->read_mostly
+        ? fscl_map_write_snapshot(shard, write, key, value, hash)
+        : write(&shard->map, key, value, hash);
+    fscl_rwlock_write_unlock(&shard->lock);
+
+    return result;
+}
+
+// Helper function to get the pairs of a shard for reading: the published
+// snapshot of a read-mostly map, entered through the epoch record of the
+// calling thread, or else the shard map under its read lock. Release them
+// with fscl_map_shard_unpin.
+static const cmap* fscl_map_shard_pin(const cmap* map, struct cmap_shard* shard, fscl_epoch_record** record) {
+    *record = map->read_mostly ? fscl_epoch_enter() : NULL;
+    if (*record == NULL) {
+        // Writers free retired snapshots under the write lock, so the read
+        // lock also covers readers that could not get an epoch record
+        fscl_rwlock_read_lock(&shard->lock);
+    }
+
+    if (!map->read_mostly) {
+        return &shard->map;
+    }
+
+    const struct cmap_snapshot* snapshot = (const struct cmap_snapshot*)fscl_atomic_load_ptr((void* const volatile*)&shard->snapshot);
+    return &snapshot->map;
+}
+
+static void fscl_map_shard_unpin(struct cmap_shard* shard, fscl_epoch_record* record) {
+    if (record != NULL) {
+        fscl_epoch_exit(record);
+    } else {
+        fscl_rwlock_read_unlock(&shard->lock);
+    }
+}
+
+// Helper function to look up key and copy out its value when asked,
+// pinning its shard when the map is concurrent
+static bool fscl_map_read(const cmap* map, const ctofu* key, ctofu* value) {
+    uint64_t hash = fscl_tofu_hash(key, TOFU_HASH_SEED);
+    if (map->shards == NULL) {
+        size_t entry = fscl_map_lookup(map, key, hash);
+        if (entry != MAP_NOT_FOUND && value != NULL) {
+            *value = map->values[entry];
+        }
+        return entry != MAP_NOT_FOUND;
+    }
+
+    struct cmap_shard* shard = fscl_map_shard(map, hash);
+    fscl_epoch_record* record;
+    const cmap* target = fscl_map_shard_pin(map, shard, &record);
+
+    size_t entry = fscl_map_lookup(target, key, hash);
+    if (entry != MAP_NOT_FOUND && value != NULL) {
+        *value = target->values[entry];
+    }
+
+    fscl_map_shard_unpin(shard, record);
+
+    return entry != MAP_NOT_FOUND;
+}
+
+// Helper function to let a single-threaded map finish part of a pending
+// resize before a read. Concurrent readers share a read lock and leave
+// migration to the writers of each shard.
+static void fscl_map_read_step(cmap* map) {
+    if (map->shards == NULL) {
+        fscl_map_migrate(map, MAP_MIGRATE_STEP);
+    }
+}
+
+// =======================
+// BULK HELPERS
+// =======================
+
+// Helper function to prefetch the first index slot a hash probes
+static void fscl_map_index_prefetch(const cmap_index* index, uint64_t hash) {
+    if (index->count == 0) {
+        return;
+    }
+
+    size_t pos = (size_t)hash & (index->count - 1);
+    if (index->group != NULL) {
+        MAP_PREFETCH(&index->ctrl[pos]);
+        MAP_PREFETCH(&index->entries[pos]);
+    } else {
+        MAP_PREFETCH(&index->slots[pos]);
+    }
+}
+
+// Helper function to prefetch the pair the first slot of a hash points at,
+// once that slot has been prefetched and its hash fragment matches
+static void fscl_map_entry_prefetch(const cmap* map, uint64_t hash) {
+    const cmap_index* index = &map->index;
+    if (index->count == 0) {
+        return;
+    }
+
+    size_t pos = (size_t)hash & (index->count - 1);
+    if (index->group != NULL) {
+        if (index->ctrl[pos] != fscl_map_ctrl_tag(hash)) {
+            return;
+        }
+    } else if (!fscl_map_slot_full(index->slots[pos]) || (index->slots[pos] & MAP_SLOT_HASH_MASK) != (hash & MAP_SLOT_HASH_MASK)) {
+        return;
+    }
+
+    size_t entry = fscl_map_index_entry(index, pos);
+    MAP_PREFETCH(&map->keys[entry]);
+    MAP_PREFETCH(&map->values[entry]);
+}
+
+// Helper function to size a map once for n more entries. Any resize in
+// flight is finished, so every insert of a bulk load probes one index.
+static ctofu_error fscl_map_reserve(cmap* map, size_t n) {
+    if (n > MAP_MAX_SIZE - map->size) {
+        return fscl_tofu_error(TOFU_WAS_BAD_RANGE); // Map would overflow
+    }
+
+    fscl_map_migrate(map, SIZE_MAX);
+    ctofu_error result = fscl_map_reserve_entries(map, map->size + n);
+    if (result != TOFU_SUCCESS) {
+        return result;
+    }
+
+    const size_t load = map->size + map->index.tombstones + n;
+    if (map->index.count == 0 || load * MAP_MAX_LOAD_DEN > map->index.count * MAP_MAX_LOAD_NUM) {
+        return fscl_map_index_rebuild(map, fscl_map_index_count_for(&map->index, map->size + n));
+    }
+
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+// Helper function to insert n pairs into a single-threaded map. Each batch
+// is hashed and its first slots prefetched before any key is probed. hashes
+// holds precomputed hashes or is NULL. Keys already present, including
+// earlier ones of the same call, are skipped.
+static ctofu_error fscl_map_insert_batch(cmap* map, const ctofu* keys, const ctofu* values, const uint64_t* hashes, size_t n) {
+    ctofu_error result = fscl_map_reserve(map, n);
+    if (result != TOFU_SUCCESS) {
+        return result;
+    }
+
+    bool skipped = false;
+    uint64_t batch[MAP_BATCH];
+    for (size_t start = 0; start < n; start += MAP_BATCH) {
+        size_t count = n - start < MAP_BATCH ? n - start : MAP_BATCH;
+        for (size_t i = 0; i < count; i++) {
+            batch[i] = hashes != NULL ? hashes[start + i] : fscl_tofu_hash(&keys[start + i], TOFU_HASH_SEED);
+            fscl_map_index_prefetch(&map->index, batch[i]);
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            size_t vacancy;
+            if (fscl_map_probe(map, &keys[start + i], batch[i], &vacancy) != MAP_NOT_FOUND) {
+                skipped = true;
+                continue;
+            }
+
+            result = fscl_map_append(map, &keys[start + i], &values[start + i], batch[i], vacancy, NULL);
+            if (result != TOFU_SUCCESS) {
+                return result;
+            }
+        }
+    }
+
+    return fscl_tofu_error(skipped ? TOFU_WAS_MISMATCH : TOFU_SUCCESS);
+}
+
+// Helper function to look up n keys of one map in batches: each batch is
+// hashed and its first slots prefetched before any key is resolved. order
+// maps the i-th key looked up to its position in keys and the outputs, or
+// is NULL for the identity. hashes holds precomputed hashes by position or
+// is NULL. Returns the number of keys found.
+static size_t fscl_map_get_batch(const cmap* map, const ctofu* keys, const uint64_t* hashes, const size_t* order, size_t n, ctofu* out_values, bool* out_found) {
+    size_t found = 0;
+    uint64_t batch[MAP_BATCH];
+    for (size_t start = 0; start < n; start += MAP_BATCH) {
+        size_t count = n - start < MAP_BATCH ? n - start : MAP_BATCH;
+        for (size_t i = 0; i < count; i++) {
+            size_t at = order != NULL ? order[start + i] : start + i;
+            batch[i] = hashes != NULL ? hashes[at] : fscl_tofu_hash(&keys[at], TOFU_HASH_SEED);
+            fscl_map_index_prefetch(&map->index, batch[i]);
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            fscl_map_entry_prefetch(map, batch[i]);
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            size_t at = order != NULL ? order[start + i] : start + i;
+            size_t entry = fscl_map_lookup(map, &keys[at], batch[i]);
+            if (entry != MAP_NOT_FOUND) {
+                out_values[at] = map->values[entry];
+                found++;
+            }
+            if (out_found != NULL) {
+                out_found[at] = entry != MAP_NOT_FOUND;
+            }
+        }
+    }
+
+    return found;
+}
+
+// Helper function to look up n keys of a concurrent map. Keys are grouped
+// by shard so each shard is pinned once.
+static ctofu_error fscl_map_get_sharded(const cmap* map, const ctofu* keys, size_t n, ctofu* out_values, bool* out_found) {
+    size_t shards = map->shard_count;
+    uint64_t* hashes = (uint64_t*)malloc(n * sizeof(uint64_t));
+    size_t* order = (size_t*)malloc(n * sizeof(size_t));
+    size_t* start = (size_t*)calloc(shards + 1, sizeof(size_t));
+    size_t* fill = (size_t*)malloc(shards * sizeof(size_t));
+    ctofu_error result = fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+
+    if (hashes != NULL && order != NULL && start != NULL && fill != NULL) {
+        // Counting sort of the key positions by shard
+        for (size_t i = 0; i < n; i++) {
+            hashes[i] = fscl_tofu_hash(&keys[i], TOFU_HASH_SEED);
+            start[(size_t)(fscl_map_shard(map, hashes[i]) - map->shards) + 1]++;
+        }
+        for (size_t s = 0; s < shards; s++) {
+            start[s + 1] += start[s];
+        }
+        memcpy(fill, start, shards * sizeof(size_t));
+        for (size_t i = 0; i < n; i++) {
+            order[fill[fscl_map_shard(map, hashes[i]) - map->shards]++] = i;
+        }
+
+        size_t found = 0;
+        for (size_t s = 0; s < shards; s++) {
+            size_t count = start[s + 1] - start[s];
+            if (count == 0) {
+                continue;
+            }
+
+            struct cmap_shard* shard = &map->shards[s];
+            fscl_epoch_record* record;
+            const cmap* target = fscl_map_shard_pin(map, shard, &record);
+            found += fscl_map_get_batch(target, keys, hashes, &order[start[s]], count, out_values, out_found);
+            fscl_map_shard_unpin(shard, record);
+        }
+
+        result = fscl_tofu_error(found == n ? TOFU_SUCCESS : TOFU_NOT_FOUND);
+    }
+
+    free(hashes);
+    free(order);
+    free(start);
+    free(fill);
+    return result;
+}
+
+// Helper function to bulk insert into a concurrent map. Pairs are grouped
+// by shard so each shard is locked once, and on read-mostly maps copied
+// and published once.
+static ctofu_error fscl_map_insert_sharded(cmap* map, const ctofu* keys, const ctofu* values, size_t n) {
+    size_t shards = map->shard_count;
+    uint64_t* hashes = (uint64_t*)malloc(n * sizeof(uint64_t));
+    uint64_t* grouped_hashes = (uint64_t*)malloc(n * sizeof(uint64_t));
+    ctofu* grouped_keys = (ctofu*)malloc(n * sizeof(ctofu));
+    ctofu* grouped_values = (ctofu*)malloc(n * sizeof(ctofu));
+    size_t* start = (size_t*)calloc(shards + 1, sizeof(size_t));
+    size_t* fill = (size_t*)malloc(shards * sizeof(size_t));
+    ctofu_error result = fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+
+    if (hashes != NULL && grouped_hashes != NULL && grouped_keys != NULL && grouped_values != NULL && start != NULL && fill != NULL) {
+        // Counting sort of the pairs by shard
+        for (size_t i = 0; i < n; i++) {
+            hashes[i] = fscl_tofu_hash(&keys[i], TOFU_HASH_SEED);
+            start[(size_t)(fscl_map_shard(map, hashes[i]) - map->shards) + 1]++;
+        }
+        for (size_t s = 0; s < shards; s++) {
+            start[s + 1] += start[s];
+        }
+        memcpy(fill, start, shards * sizeof(size_t));
+        for (size_t i = 0; i < n; i++) {
+            size_t at = fill[fscl_map_shard(map, hashes[i]) - map->shards]++;
+            grouped_hashes[at] = hashes[i];
+            grouped_keys[at] = keys[i];
+            grouped_values[at] = values[i];
+        }
+
+        bool skipped = false;
+        result = fscl_tofu_error(TOFU_SUCCESS);
+        for (size_t s = 0; s < shards; s++) {
+            size_t count = start[s + 1] - start[s];
+            if (count == 0) {
+                continue;
+            }
+
+            struct cmap_shard* shard = &map->shards[s];
+            ctofu_error shard_result;
+            fscl_rwlock_write_lock(&shard->lock);
+            if (map->read_mostly) {
+                struct cmap_snapshot* copy = fscl_map_snapshot_copy(&shard->snapshot->map);
+                shard_result = fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+                if (copy != NULL) {
+                    shard_result = fscl_map_insert_batch(&copy->map, &grouped_keys[start[s]], &grouped_values[start[s]], &grouped_hashes[start[s]], count);
+                    if (shard_result == TOFU_SUCCESS || shard_result == TOFU_WAS_MISMATCH) {
+                        fscl_map_publish(shard, copy);
+                    } else {
+                        fscl_map_snapshot_free(copy);
+                    }
+                }
+            } else {
+                shard_result = fscl_map_insert_batch(&shard->map, &grouped_keys[start[s]], &grouped_values[start[s]], &grouped_hashes[start[s]], count);
+            }
+            fscl_rwlock_write_unlock(&shard->lock);
+
+            if (shard_result == TOFU_WAS_MISMATCH) {
+                skipped = true;
+            } else if (shard_result != TOFU_SUCCESS && result == TOFU_SUCCESS) {
+                result = shard_result;
+            }
+        }
+
+        if (result == TOFU_SUCCESS && skipped) {
+            result = fscl_tofu_error(TOFU_WAS_MISMATCH);
+        }
+    }
+
+    free(hashes);
+    free(grouped_hashes);
+    free(grouped_keys);
+    free(grouped_values);
+    free(start);
+    free(fill);
+    return result;
+}
+
 // =======================
 // CREATE and DELETE
 // =======================
 
-cmap* fscl_map_create(ctofu_type list_type) {
-    cmap* new_map = (cmap*)malloc(sizeof(cmap));
+cmap* fscl_map_create(ctofu_type list_type) {
+    cmap* new_map = (cmap*)malloc(sizeof(cmap));
+    if (new_map == NULL) {
+        // Handle memory allocation failure
+        return NULL;
+    }
+
+    fscl_map_init(new_map, NULL);
+
+    return new_map;
+}
+
+cmap* fscl_map_create_swiss(ctofu_type list_type) {
+    cmap* new_map = fscl_map_create(list_type);
+    if (new_map == NULL) {
+        return NULL;
+    }
+
+    new_map->index.group = fscl_map_group_select();
+
+    return new_map;
+}
+
+cmap* fscl_map_create_concurrent(ctofu_type list_type, size_t shards) {
+    if (shards == 0 || shards > MAP_MAX_SHARDS) {
+        return NULL;
+    }
+
+    // Round up to a power of two so a shard is picked with a mask
+    size_t count = 1;
+    while (count < shards) {
+        count <<= 1;
+    }
+
+    cmap* new_map = fscl_map_create(list_type);
+    if (new_map == NULL) {
+        return NULL;
+    }
+
+    new_map->shards = (struct cmap_shard*)malloc(count * sizeof(struct cmap_shard));
+    if (new_map->shards == NULL) {
+        free(new_map);
+        return NULL;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        if (!fscl_rwlock_init(&new_map->shards[i].lock)) {
+            while (i-- > 0) {
+                fscl_rwlock_destroy(&new_map->shards[i].lock);
+            }
+            free(new_map->shards);
+            free(new_map);
+            return NULL;
+        }
+        fscl_map_init(&new_map->shards[i].map, NULL);
+        new_map->shards[i].snapshot = NULL;
+        new_map->shards[i].retired = NULL;
+    }
+    new_map->shard_count = count;
+
+    return new_map;
+}
+
+cmap* fscl_map_create_read_mostly(ctofu_type list_type, size_t shards) {
+    cmap* new_map = fscl_map_create_concurrent(list_type, shards);
     if (new_map == NULL) {
-        // Handle memory allocation failure
         return NULL;
     }
 
-    new_map->size = 0;
+    new_map->read_mostly = true;
+    for (size_t i = 0; i < new_map->shard_count; i++) {
+        new_map->shards[i].snapshot = fscl_map_snapshot_copy(NULL);
+        if (new_map->shards[i].snapshot == NULL) {
+            fscl_map_erase(new_map);
+            return NULL;
+        }
+    }
 
     return new_map;
 }
@@ -36,6 +1330,20 @@ void fscl_map_erase(cmap* map) {
         return;
     }
 
+    for (size_t i = 0; i < map->shard_count; i++) {
+        struct cmap_shard* shard = &map->shards[i];
+        fscl_map_release(&shard->map);
+        fscl_map_snapshot_free(shard->snapshot);
+        while (shard->retired != NULL) {
+            struct cmap_snapshot* next = shard->retired->next;
+            fscl_map_snapshot_free(shard->retired);
+            shard->retired = next;
+        }
+        fscl_rwlock_destroy(&shard->lock);
+    }
+    free(map->shards);
+
+    fscl_map_release(map);
     free(map);
 }
 
@@ -44,70 +1352,219 @@ void fscl_map_erase(cmap* map) {
 // =======================
 
 ctofu_error fscl_map_insert(cmap* map, ctofu key, ctofu value) {
+    return fscl_map_insert_ref(map, &key, &value);
+}
+
+ctofu_error fscl_map_remove(cmap* map, ctofu key) {
+    return fscl_map_remove_ref(map, &key);
+}
+
+ctofu_error fscl_map_search(cmap* map, ctofu key) {
     if (map == NULL) {
         return fscl_tofu_error(TOFU_WAS_NULLPTR);
     }
 
-    if (map->size >= MAX_MAP_SIZE) {
-        return fscl_tofu_error(TOFU_WAS_BAD_RANGE); // Map is full
+    fscl_map_read_step(map);
+    if (fscl_map_read(map, &key, NULL)) {
+        return fscl_tofu_error(TOFU_SUCCESS); // Found
     }
 
-    // Check if the key already exists
-    for (size_t i = 0; i < map->size; ++i) {
-        if (fscl_tofu_compare(&map->keys[i], &key) == 0) {
-            return fscl_tofu_error(TOFU_WAS_MISMATCH); // Duplicate key
-        }
+    return fscl_tofu_error(TOFU_NOT_FOUND); // Key not found
+}
+
+cmap_entry fscl_map_entry(cmap* map, ctofu key) {
+    return fscl_map_entry_ref(map, &key);
+}
+
+bool fscl_map_entry_occupied(const cmap_entry* entry) {
+    return entry != NULL && entry->map != NULL && entry->position != MAP_NOT_FOUND;
+}
+
+ctofu* fscl_map_entry_value(const cmap_entry* entry) {
+    if (!fscl_map_entry_occupied(entry)) {
+        return NULL;
     }
 
-    map->keys[map->size] = key;
-    map->values[map->size] = value;
-    map->size++;
+    return &entry->map->values[entry->position];
+}
+
+ctofu_error fscl_map_entry_set(cmap_entry* entry, ctofu value) {
+    if (entry == NULL || entry->map == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
 
-    return fscl_tofu_error(TOFU_SUCCESS);
+    if (entry->position != MAP_NOT_FOUND) {
+        entry->map->values[entry->position] = value;
+        return fscl_tofu_error(TOFU_SUCCESS);
+    }
+
+    // Fill the vacant entry in the slot its probe already found
+    return fscl_map_append(entry->map, &entry->key, &value, entry->hash, entry->vacancy, &entry->position);
 }
 
-ctofu_error fscl_map_remove(cmap* map, ctofu key) {
-    if (map == NULL) {
+ctofu_error fscl_map_upsert(cmap* map, ctofu key, ctofu value) {
+    return fscl_map_upsert_ref(map, &key, &value);
+}
+
+ctofu_error fscl_map_get_or_insert(cmap* map, ctofu key, ctofu value, ctofu** stored) {
+    if (map == NULL || stored == NULL) {
         return fscl_tofu_error(TOFU_WAS_NULLPTR);
     }
 
-    size_t index = MAX_MAP_SIZE;
+    if (map->shards != NULL) {
+        // The stored value could move as soon as the shard is unlocked
+        *stored = NULL;
+        return fscl_tofu_error(TOFU_WAS_MISMATCH);
+    }
 
-    // Find the index of the key
-    for (size_t i = 0; i < map->size; ++i) {
-        if (fscl_tofu_compare(&map->keys[i], &key) == 0) {
-            index = i;
-            break;
+    cmap_entry entry = fscl_map_entry(map, key);
+    if (!fscl_map_entry_occupied(&entry)) {
+        ctofu_error result = fscl_map_entry_set(&entry, value);
+        if (result != TOFU_SUCCESS) {
+            *stored = NULL;
+            return result;
         }
     }
 
-    if (index == MAX_MAP_SIZE) {
-        return fscl_tofu_error(TOFU_NOT_FOUND); // Key not found
+    *stored = fscl_map_entry_value(&entry);
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+// =======================
+// REFERENCE FUNCTIONS
+// =======================
+
+const ctofu* fscl_map_find(const cmap* map, const ctofu* key) {
+    if (map == NULL || key == NULL || map->shards != NULL) {
+        return NULL;
     }
 
-    // Shift elements to fill the gap
-    for (size_t i = index; i < map->size - 1; ++i) {
-        map->keys[i] = map->keys[i + 1];
-        map->values[i] = map->values[i + 1];
+    size_t entry = fscl_map_lookup(map, key, fscl_tofu_hash(key, TOFU_HASH_SEED));
+    if (entry == MAP_NOT_FOUND) {
+        return NULL;
     }
 
-    map->size--;
+    return &map->values[entry];
+}
 
-    return fscl_tofu_error(TOFU_SUCCESS);
+bool fscl_map_contains_ref(const cmap* map, const ctofu* key) {
+    if (map == NULL || key == NULL) {
+        return false;
+    }
+
+    return fscl_map_read(map, key, NULL);
 }
 
-ctofu_error fscl_map_search(cmap* map, ctofu key) {
-    if (map == NULL) {
+ctofu_error fscl_map_insert_ref(cmap* map, const ctofu* key, const ctofu* value) {
+    if (map == NULL || key == NULL || value == NULL) {
         return fscl_tofu_error(TOFU_WAS_NULLPTR);
     }
 
-    for (size_t i = 0; i < map->size; ++i) {
-        if (fscl_tofu_compare(&map->keys[i], &key) == 0) {
-            return fscl_tofu_error(TOFU_SUCCESS); // Found
-        }
+    return fscl_map_write(map, fscl_map_insert_hashed, key, value);
+}
+
+ctofu_error fscl_map_remove_ref(cmap* map, const ctofu* key) {
+    if (map == NULL || key == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
     }
 
-    return fscl_tofu_error(TOFU_NOT_FOUND); // Key not found
+    return fscl_map_write(map, fscl_map_remove_hashed, key, NULL);
+}
+
+ctofu_error fscl_map_setter_ref(cmap* map, const ctofu* key, const ctofu* value) {
+    if (map == NULL || key == NULL || value == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    return fscl_map_write(map, fscl_map_setter_hashed, key, value);
+}
+
+ctofu_error fscl_map_upsert_ref(cmap* map, const ctofu* key, const ctofu* value) {
+    if (map == NULL || key == NULL || value == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    return fscl_map_write(map, fscl_map_upsert_hashed, key, value);
+}
+
+cmap_entry fscl_map_entry_ref(cmap* map, const ctofu* key) {
+    cmap_entry entry;
+    entry.map = map;
+    entry.hash = 0;
+    entry.position = MAP_NOT_FOUND;
+    entry.vacancy = MAP_NOT_FOUND;
+
+    // Handles point into storage that other threads of a concurrent map
+    // may move, so those maps only hand out detached ones
+    if (map == NULL || key == NULL || map->shards != NULL) {
+        entry.map = NULL;
+        return entry;
+    }
+
+    entry.key = *key;
+
+    fscl_map_migrate(map, MAP_MIGRATE_STEP);
+    entry.hash = fscl_tofu_hash(key, TOFU_HASH_SEED);
+    entry.position = fscl_map_probe(map, key, entry.hash, &entry.vacancy);
+
+    return entry;
+}
+
+// =======================
+// BULK FUNCTIONS
+// =======================
+
+ctofu_error fscl_map_insert_many(cmap* map, const ctofu* keys, const ctofu* values, size_t n) {
+    if (map == NULL || (n > 0 && (keys == NULL || values == NULL))) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    if (n == 0) {
+        return fscl_tofu_error(TOFU_SUCCESS);
+    }
+
+    if (map->shards != NULL) {
+        return fscl_map_insert_sharded(map, keys, values, n);
+    }
+
+    return fscl_map_insert_batch(map, keys, values, NULL, n);
+}
+
+ctofu_error fscl_map_get_many(cmap* map, const ctofu* keys, size_t n, ctofu* out_values, bool* out_found) {
+    if (map == NULL || (n > 0 && (keys == NULL || out_values == NULL))) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    if (n == 0) {
+        return fscl_tofu_error(TOFU_SUCCESS);
+    }
+
+    if (map->shards != NULL) {
+        return fscl_map_get_sharded(map, keys, n, out_values, out_found);
+    }
+
+    fscl_map_read_step(map);
+    size_t found = fscl_map_get_batch(map, keys, NULL, NULL, n, out_values, out_found);
+    return fscl_tofu_error(found == n ? TOFU_SUCCESS : TOFU_NOT_FOUND);
+}
+
+cmap* fscl_map_from_vectors(const cvector* keys, const cvector* values) {
+    if (keys == NULL || values == NULL || keys->size != values->size) {
+        return NULL;
+    }
+
+    cmap* new_map = fscl_map_create(keys->expected_type);
+    if (new_map == NULL) {
+        return NULL;
+    }
+
+    ctofu_error result = fscl_map_insert_many(new_map, keys->data, values->data, keys->size);
+    if (result != TOFU_SUCCESS && result != TOFU_WAS_MISMATCH) {
+        fscl_map_erase(new_map);
+        return NULL;
+    }
+
+    return new_map;
 }
 
 // =======================
@@ -119,7 +1576,18 @@ size_t fscl_map_size(cmap* map) {
         return 0;
     }
 
-    return map->size;
+    if (map->shards == NULL) {
+        return map->size;
+    }
+
+    size_t size = 0;
+    for (size_t i = 0; i < map->shard_count; i++) {
+        fscl_epoch_record* record;
+        size += fscl_map_shard_pin(map, &map->shards[i], &record)->size;
+        fscl_map_shard_unpin(&map->shards[i], record);
+    }
+
+    return size;
 }
 
 ctofu_error fscl_map_getter(cmap* map, ctofu key, ctofu* value) {
@@ -127,34 +1595,66 @@ ctofu_error fscl_map_getter(cmap* map, ctofu key, ctofu* value) {
         return fscl_tofu_error(TOFU_WAS_NULLPTR);
     }
 
-    for (size_t i = 0; i < map->size; ++i) {
-        if (fscl_tofu_compare(&map->keys[i], &key) == 0) {
-            *value = map->values[i];
-            return fscl_tofu_error(TOFU_SUCCESS); // Found
-        }
+    fscl_map_read_step(map);
+    if (!fscl_map_read(map, &key, value)) {
+        return fscl_tofu_error(TOFU_NOT_FOUND); // Key not found
     }
 
-    return fscl_tofu_error(TOFU_NOT_FOUND); // Key not found
+    return fscl_tofu_error(TOFU_SUCCESS); // Found
 }
 
 ctofu_error fscl_map_setter(cmap* map, ctofu key, ctofu value) {
+    return fscl_map_setter_ref(map, &key, &value);
+}
+
+ctofu_error fscl_map_set_incremental(cmap* map, bool incremental) {
     if (map == NULL) {
         return fscl_tofu_error(TOFU_WAS_NULLPTR);
     }
 
-    for (size_t i = 0; i < map->size; ++i) {
-        if (fscl_tofu_compare(&map->keys[i], &key) == 0) {
-            // Found, update the value
-            map->values[i] = value;
-            return fscl_tofu_error(TOFU_SUCCESS);
+    for (size_t i = 0; i < map->shard_count; i++) {
+        fscl_rwlock_write_lock(&map->shards[i].lock);
+        fscl_map_set_incremental(&map->shards[i].map, incremental);
+        fscl_rwlock_write_unlock(&map->shards[i].lock);
+    }
+
+    if (!incremental) {
+        fscl_map_migrate(map, SIZE_MAX);
+    }
+    map->incremental = incremental;
+
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+ctofu_error fscl_map_for_each(cmap* map, bool (*visit)(const ctofu* key, const ctofu* value, void* context), void* context) {
+    if (map == NULL || visit == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    if (map->shards == NULL) {
+        for (size_t i = 0; i < map->size; i++) {
+            if (!visit(&map->keys[i], &map->values[i], context)) {
+                break;
+            }
         }
+        return fscl_tofu_error(TOFU_SUCCESS);
     }
 
-    return fscl_tofu_error(TOFU_NOT_FOUND); // Key not found
+    bool more = true;
+    for (size_t i = 0; i < map->shard_count && more; i++) {
+        fscl_epoch_record* record;
+        const cmap* pairs = fscl_map_shard_pin(map, &map->shards[i], &record);
+        for (size_t j = 0; j < pairs->size && more; j++) {
+            more = visit(&pairs->keys[j], &pairs->values[j], context);
+        }
+        fscl_map_shard_unpin(&map->shards[i], record);
+    }
+
+    return fscl_tofu_error(TOFU_SUCCESS);
 }
 
 bool fscl_map_not_empty(cmap* map) {
-    return map != NULL && map->size > 0;
+    return fscl_map_size(map) > 0;
 }
 
 bool fscl_map_not_cnullptr(cmap* map) {
@@ -162,7 +1662,7 @@ bool fscl_map_not_cnullptr(cmap* map) {
 }
 
 bool fscl_map_is_empty(cmap* map) {
-    return map == NULL || map->size == 0;
+    return fscl_map_size(map) == 0;
 }
 
 bool fscl_map_is_cnullptr(cmap* map) {
@@ -174,13 +1674,8 @@ bool fscl_map_contains(cmap* map, ctofu key) {
         return false;
     }
 
-    for (size_t i = 0; i < map->size; ++i) {
-        if (fscl_tofu_compare(&map->keys[i], &key) == 0) {
-            return true; // Found
-        }
-    }
-
-    return false; // Key not found
+    fscl_map_read_step(map);
+    return fscl_map_contains_ref(map, &key);
 }
 
 // =======================
@@ -213,5 +1708,281 @@ ctofu_iterator fscl_map_iterator_next(ctofu_iterator iterator) {
 }
 
 bool fscl_map_iterator_has_next(ctofu_iterator iterator) {
-    return iterator.index < MAX_MAP_SIZE;
+    return iterator.current_key != NULL && iterator.current_key->type != TOFU_INVALID_TYPE;
+}
+
+// =======================
+// FROZEN FUNCTIONS
+// =======================
+
+// Pairs copied out of a map by fscl_map_for_each while freezing it
+typedef struct {
+    ctofu* keys;
+    ctofu* values;
+    size_t count;
+    size_t capacity;
+} fscl_map_frozen_stage;
+
+// Helper function for fscl_map_for_each that copies each pair into a stage
+static bool fscl_map_frozen_collect(const ctofu* key, const ctofu* value, void* context) {
+    fscl_map_frozen_stage* stage = (fscl_map_frozen_stage*)context;
+    if (stage->count == stage->capacity) {
+        return false; // A concurrent writer grew the map after it was sized
+    }
+
+    stage->keys[stage->count] = *key;
+    stage->values[stage->count] = *value;
+    stage->count++;
+    return true;
+}
+
+// Helper function to pick the bucket of a key hash from its upper half
+static size_t fscl_map_frozen_bucket(uint64_t hash, size_t buckets) {
+    return (size_t)(((hash >> 32) * (uint64_t)buckets) >> 32);
+}
+
+// Helper function to place a key hash in one of size slots under a bucket seed
+static size_t fscl_map_frozen_slot(uint64_t hash, uint32_t seed, size_t size) {
+    uint64_t x = hash ^ ((uint64_t)seed * 0x9e3779b97f4a7c15ULL);
+    x ^= x >> 31;
+    x *= 0xd6e8feb86659fd93ULL;
+    x ^= x >> 32;
+    return (size_t)(((x & 0xffffffffULL) * (uint64_t)size) >> 32);
+}
+
+// Helper function to find the only slot that can hold key
+static size_t fscl_map_frozen_locate(const cmap_frozen* frozen, const ctofu* key) {
+    uint64_t hash = fscl_tofu_hash(key, frozen->seed);
+    uint32_t displacement = frozen->displacements[fscl_map_frozen_bucket(hash, frozen->bucket_count)];
+    if (displacement & MAP_FROZEN_DIRECT) {
+        return displacement & ~MAP_FROZEN_DIRECT;
+    }
+
+    return fscl_map_frozen_slot(hash, displacement, frozen->size);
+}
+
+// Helper function to give every bucket a displacement so the hashes land in
+// distinct slots, storing the slot of each key in slot_of. Buckets are
+// placed largest first while most slots are free, then single-key buckets
+// take the slots left over, so the whole search runs in linear time.
+// Fails when a bucket finds no seed.
+static bool fscl_map_frozen_search(cmap_frozen* frozen, const uint64_t* hashes, size_t* slot_of, size_t* scratch, uint8_t* taken) {
+    size_t size = frozen->size;
+    size_t buckets = frozen->bucket_count;
+    size_t* start = scratch;                 // buckets + 1: first key of each bucket in order
+    size_t* order = start + buckets + 1;     // size: keys sorted by bucket
+    size_t* by_size = order + size;          // buckets: buckets sorted by size, largest first
+    size_t* sizes = by_size + buckets;       // size + 2: counting sort of bucket sizes
+    size_t* tried = sizes + size + 2;        // size: slots tried for one bucket
+
+    // Counting sort of the keys by bucket
+    for (size_t i = 0; i < size; i++) {
+        start[fscl_map_frozen_bucket(hashes[i], buckets) + 1]++;
+    }
+    size_t largest = 0;
+    for (size_t b = 0; b < buckets; b++) {
+        if (start[b + 1] > largest) {
+            largest = start[b + 1];
+        }
+        start[b + 1] += start[b];
+    }
+    memcpy(by_size, start, buckets * sizeof(size_t));
+    for (size_t i = 0; i < size; i++) {
+        order[by_size[fscl_map_frozen_bucket(hashes[i], buckets)]++] = i;
+    }
+
+    // Counting sort of the buckets by size
+    for (size_t b = 0; b < buckets; b++) {
+        sizes[largest - (start[b + 1] - start[b]) + 1]++;
+    }
+    for (size_t k = 0; k <= largest; k++) {
+        sizes[k + 1] += sizes[k];
+    }
+    for (size_t b = 0; b < buckets; b++) {
+        by_size[sizes[largest - (start[b + 1] - start[b])]++] = b;
+    }
+
+    size_t next_free = 0;
+    for (size_t i = 0; i < buckets; i++) {
+        size_t b = by_size[i];
+        size_t count = start[b + 1] - start[b];
+        const size_t* keys = &order[start[b]];
+
+        if (count == 0) {
+            frozen->displacements[b] = 0;
+            continue;
+        }
+
+        if (count == 1) {
+            while (taken[next_free]) {
+                next_free++;
+            }
+            taken[next_free] = 1;
+            slot_of[keys[0]] = next_free;
+            frozen->displacements[b] = MAP_FROZEN_DIRECT | (uint32_t)next_free;
+            continue;
+        }
+
+        uint32_t seed = 0;
+        for (; seed < MAP_FROZEN_MAX_SEEDS; seed++) {
+            size_t j = 0;
+            for (; j < count; j++) {
+                tried[j] = fscl_map_frozen_slot(hashes[keys[j]], seed, size);
+                if (taken[tried[j]]) {
+                    break;
+                }
+                taken[tried[j]] = 1;
+            }
+            if (j == count) {
+                break;
+            }
+            while (j-- > 0) {
+                taken[tried[j]] = 0;
+            }
+        }
+        if (seed == MAP_FROZEN_MAX_SEEDS) {
+            return false;
+        }
+
+        frozen->displacements[b] = seed;
+        for (size_t j = 0; j < count; j++) {
+            slot_of[keys[j]] = tried[j];
+        }
+    }
+
+    return true;
+}
+
+// Helper function to lay out the staged pairs in the slots of a minimal
+// perfect hash. Two keys with the same hash can never be separated, so a
+// failed search is retried with a fresh hash seed.
+static bool fscl_map_frozen_build(cmap_frozen* frozen, const fscl_map_frozen_stage* stage) {
+    size_t size = frozen->size;
+    size_t buckets = frozen->bucket_count;
+    size_t scratch_count = 2 * buckets + 3 * size + 3;
+
+    uint64_t* hashes = (uint64_t*)malloc((size + 1) * sizeof(uint64_t));
+    size_t* slot_of = (size_t*)malloc((size + 1) * sizeof(size_t));
+    size_t* scratch = (size_t*)malloc(scratch_count * sizeof(size_t));
+    uint8_t* taken = (uint8_t*)malloc(size + 1);
+    bool placed = false;
+
+    if (hashes != NULL && slot_of != NULL && scratch != NULL && taken != NULL) {
+        for (uint64_t attempt = 0; attempt < MAP_FROZEN_ATTEMPTS && !placed; attempt++) {
+            frozen->seed = TOFU_HASH_SEED + attempt * 0x9e3779b97f4a7c15ULL;
+            for (size_t i = 0; i < size; i++) {
+                hashes[i] = fscl_tofu_hash(&stage->keys[i], frozen->seed);
+            }
+            memset(scratch, 0, scratch_count * sizeof(size_t));
+            memset(taken, 0, size + 1);
+            placed = fscl_map_frozen_search(frozen, hashes, slot_of, scratch, taken);
+        }
+    }
+
+    if (placed) {
+        for (size_t i = 0; i < size; i++) {
+            frozen->pairs[2 * slot_of[i]] = stage->keys[i];
+            frozen->pairs[2 * slot_of[i] + 1] = stage->values[i];
+        }
+    }
+
+    free(hashes);
+    free(slot_of);
+    free(scratch);
+    free(taken);
+    return placed;
+}
+
+cmap_frozen* fscl_map_freeze(cmap* map) {
+    if (map == NULL) {
+        return NULL;
+    }
+
+    // Slots of single-key buckets must fit below the direct marker
+    size_t capacity = fscl_map_size(map);
+    if (capacity >= MAP_FROZEN_DIRECT) {
+        return NULL;
+    }
+
+    fscl_map_frozen_stage stage;
+    stage.keys = (ctofu*)malloc((capacity + 1) * sizeof(ctofu));
+    stage.values = (ctofu*)malloc((capacity + 1) * sizeof(ctofu));
+    stage.count = 0;
+    stage.capacity = capacity;
+
+    cmap_frozen* frozen = NULL;
+    if (stage.keys != NULL && stage.values != NULL) {
+        frozen = (cmap_frozen*)malloc(sizeof(cmap_frozen));
+    }
+
+    if (frozen != NULL) {
+        fscl_map_for_each(map, fscl_map_frozen_collect, &stage);
+
+        frozen->size = stage.count;
+        frozen->bucket_count = (stage.count + MAP_FROZEN_BUCKET_KEYS - 1) / MAP_FROZEN_BUCKET_KEYS;
+        if (frozen->bucket_count == 0) {
+            frozen->bucket_count = 1;
+        }
+        frozen->seed = TOFU_HASH_SEED;
+        frozen->pairs = (ctofu*)malloc((2 * stage.count + 1) * sizeof(ctofu));
+        frozen->displacements = (uint32_t*)calloc(frozen->bucket_count, sizeof(uint32_t));
+
+        if (frozen->pairs == NULL || frozen->displacements == NULL || !fscl_map_frozen_build(frozen, &stage)) {
+            fscl_map_frozen_erase(frozen);
+            frozen = NULL;
+        }
+    }
+
+    free(stage.keys);
+    free(stage.values);
+    return frozen;
+}
+
+void fscl_map_frozen_erase(cmap_frozen* frozen) {
+    if (frozen == NULL) {
+        return;
+    }
+
+    free(frozen->pairs);
+    free(frozen->displacements);
+    free(frozen);
+}
+
+const ctofu* fscl_map_frozen_find(const cmap_frozen* frozen, const ctofu* key) {
+    if (frozen == NULL || key == NULL || frozen->size == 0) {
+        return NULL;
+    }
+
+    const ctofu* pair = &frozen->pairs[2 * fscl_map_frozen_locate(frozen, key)];
+    if (fscl_tofu_compare(&pair[0], key) != 0) {
+        return NULL;
+    }
+
+    return &pair[1];
+}
+
+ctofu_error fscl_map_frozen_getter(const cmap_frozen* frozen, ctofu key, ctofu* value) {
+    if (frozen == NULL || value == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    const ctofu* found = fscl_map_frozen_find(frozen, &key);
+    if (found == NULL) {
+        return fscl_tofu_error(TOFU_NOT_FOUND); // Key not found
+    }
+
+    *value = *found;
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+bool fscl_map_frozen_contains(const cmap_frozen* frozen, ctofu key) {
+    return fscl_map_frozen_find(frozen, &key) != NULL;
+}
+
+size_t fscl_map_frozen_size(const cmap_frozen* frozen) {
+    if (frozen == NULL) {
+        return 0;
+    }
+
+    return frozen->size;
 }
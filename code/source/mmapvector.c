@@ -0,0 +1,586 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE // mremap and madvise
+#elif !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L // ftruncate and posix_madvise under strict ISO C
+#endif
+#include "fossil/xstructures/mmapvector.h"
+#include "xsimd.h"
+#include <limits.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Fewest payloads a growing file makes room for at once
+#define VECTOR_MMAP_MIN_GROWTH 4096
+
+// The header at the start of a vector file, sized so that the payloads
+// after it stay aligned for every payload type
+#define VECTOR_MMAP_HEADER 64
+
+struct cvector_mmap_header {
+    char magic[8];
+    uint32_t type;
+    uint32_t width;
+    uint64_t size;
+    unsigned char reserved[VECTOR_MMAP_HEADER - 24];
+};
+
+_Static_assert(sizeof(struct cvector_mmap_header) == VECTOR_MMAP_HEADER, "vector file header must be 64 bytes");
+
+static const char fscl_vector_mmap_magic[8] = { 'F', 'S', 'C', 'L', 'V', 'E', 'C', '1' };
+
+// Helper function to get the bytes of payload an element of a type uses,
+// or 0 for types whose payloads hold pointers and cannot live in a file
+static size_t fscl_vector_mmap_width(ctofu_type type) {
+    switch (type) {
+        case TOFU_INT_TYPE:
+            return sizeof(((ctofu_data*)NULL)->int_type);
+        case TOFU_UINT_TYPE:
+            return sizeof(((ctofu_data*)NULL)->uint_type);
+        case TOFU_FLOAT_TYPE:
+            return sizeof(((ctofu_data*)NULL)->float_type);
+        case TOFU_DOUBLE_TYPE:
+            return sizeof(((ctofu_data*)NULL)->double_type);
+        case TOFU_CHAR_TYPE:
+            return sizeof(((ctofu_data*)NULL)->char_type);
+        case TOFU_BOOLEAN_TYPE:
+            return sizeof(((ctofu_data*)NULL)->boolean_type);
+        default:
+            return 0;
+    }
+}
+
+static struct cvector_mmap_header* fscl_vector_mmap_header(const cvector_mmap* vector) {
+    return (struct cvector_mmap_header*)(void*)vector->map;
+}
+
+static unsigned char* fscl_vector_mmap_payload(const cvector_mmap* vector, size_t index) {
+    return vector->map + VECTOR_MMAP_HEADER + index * vector->width;
+}
+
+// =======================
+// PLATFORM HELPERS
+// =======================
+
+#if defined(_WIN32)
+// Helper function to open the file of a vector, false if it cannot be opened
+static bool fscl_vector_mmap_open_file(cvector_mmap* vector, const char* path) {
+    DWORD access = vector->mode == VECTOR_MMAP_READ ? GENERIC_READ : GENERIC_READ | GENERIC_WRITE;
+    DWORD disposition = vector->mode == VECTOR_MMAP_READ ? OPEN_EXISTING
+                      : vector->mode == VECTOR_MMAP_WRITE ? OPEN_ALWAYS : CREATE_ALWAYS;
+    HANDLE file = CreateFileA(path, access, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, disposition, FILE_ATTRIBUTE_NORMAL, NULL);
+    vector->file = (intptr_t)file;
+    return file != INVALID_HANDLE_VALUE;
+}
+
+static void fscl_vector_mmap_close_file(cvector_mmap* vector) {
+    CloseHandle((HANDLE)vector->file);
+}
+
+static bool fscl_vector_mmap_file_length(cvector_mmap* vector, size_t* length) {
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx((HANDLE)vector->file, &size) || (uint64_t)size.QuadPart > SIZE_MAX) {
+        return false;
+    }
+    *length = (size_t)size.QuadPart;
+    return true;
+}
+
+// Helper function to map the first length bytes of the file
+static bool fscl_vector_mmap_map(cvector_mmap* vector, size_t length) {
+    bool writable = vector->mode != VECTOR_MMAP_READ;
+    uint64_t size = (uint64_t)length;
+    HANDLE mapping = CreateFileMappingA((HANDLE)vector->file, NULL, writable ? PAGE_READWRITE : PAGE_READONLY,
+                                       (DWORD)(size >> 32), (DWORD)size, NULL);
+    if (mapping == NULL) {
+        return false;
+    }
+
+    void* map = MapViewOfFile(mapping, writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, length);
+    if (map == NULL) {
+        CloseHandle(mapping);
+        return false;
+    }
+
+    vector->mapping = (intptr_t)mapping;
+    vector->map = (unsigned char*)map;
+    vector->map_length = length;
+    return true;
+}
+
+static void fscl_vector_mmap_unmap(cvector_mmap* vector) {
+    UnmapViewOfFile(vector->map);
+    CloseHandle((HANDLE)vector->mapping);
+    vector->map = NULL;
+    vector->map_length = 0;
+}
+
+// Helper function to set the length of the unmapped file
+static bool fscl_vector_mmap_set_length(cvector_mmap* vector, size_t length) {
+    LARGE_INTEGER position;
+    position.QuadPart = (LONGLONG)length;
+    return SetFilePointerEx((HANDLE)vector->file, position, NULL, FILE_BEGIN) && SetEndOfFile((HANDLE)vector->file);
+}
+
+// Helper function to give the file a new length and map all of it. Windows
+// cannot resize a mapped file, so the view is dropped first.
+static bool fscl_vector_mmap_remap(cvector_mmap* vector, size_t length) {
+    size_t old_length = vector->map_length;
+    fscl_vector_mmap_unmap(vector);
+    if (fscl_vector_mmap_set_length(vector, length) && fscl_vector_mmap_map(vector, length)) {
+        return true;
+    }
+
+    // Restore the old mapping so the vector stays usable
+    fscl_vector_mmap_set_length(vector, old_length);
+    fscl_vector_mmap_map(vector, old_length);
+    return false;
+}
+
+static bool fscl_vector_mmap_flush(cvector_mmap* vector) {
+    return FlushViewOfFile(vector->map, vector->map_length) && FlushFileBuffers((HANDLE)vector->file);
+}
+
+static void fscl_vector_mmap_hint(cvector_mmap* vector, cvector_mmap_advice advice) {
+    (void)vector; // The memory manager takes no hints on file views
+    (void)advice;
+}
+#else
+static bool fscl_vector_mmap_open_file(cvector_mmap* vector, const char* path) {
+    int flags = vector->mode == VECTOR_MMAP_READ ? O_RDONLY
+              : vector->mode == VECTOR_MMAP_WRITE ? O_RDWR | O_CREAT : O_RDWR | O_CREAT | O_TRUNC;
+    int file = open(path, flags, 0644);
+    vector->file = file;
+    return file >= 0;
+}
+
+static void fscl_vector_mmap_close_file(cvector_mmap* vector) {
+    close((int)vector->file);
+}
+
+static bool fscl_vector_mmap_file_length(cvector_mmap* vector, size_t* length) {
+    struct stat info;
+    if (fstat((int)vector->file, &info) != 0 || info.st_size < 0 || (uintmax_t)info.st_size > SIZE_MAX) {
+        return false;
+    }
+    *length = (size_t)info.st_size;
+    return true;
+}
+
+static bool fscl_vector_mmap_map(cvector_mmap* vector, size_t length) {
+    int protection = vector->mode == VECTOR_MMAP_READ ? PROT_READ : PROT_READ | PROT_WRITE;
+    void* map = mmap(NULL, length, protection, MAP_SHARED, (int)vector->file, 0);
+    if (map == MAP_FAILED) {
+        return false;
+    }
+
+    vector->map = (unsigned char*)map;
+    vector->map_length = length;
+    return true;
+}
+
+static void fscl_vector_mmap_unmap(cvector_mmap* vector) {
+    munmap(vector->map, vector->map_length);
+    vector->map = NULL;
+    vector->map_length = 0;
+}
+
+static bool fscl_vector_mmap_set_length(cvector_mmap* vector, size_t length) {
+    return ftruncate((int)vector->file, (off_t)length) == 0;
+}
+
+// Helper function to give the file a new length and map all of it, in
+// place where mremap can, leaving the old mapping intact on failure
+static bool fscl_vector_mmap_remap(cvector_mmap* vector, size_t length) {
+    if (!fscl_vector_mmap_set_length(vector, length)) {
+        return false;
+    }
+
+#if defined(MREMAP_MAYMOVE)
+    void* map = mremap(vector->map, vector->map_length, length, MREMAP_MAYMOVE);
+    if (map != MAP_FAILED) {
+        vector->map = (unsigned char*)map;
+        vector->map_length = length;
+        return true;
+    }
+#else
+    unsigned char* old_map = vector->map;
+    size_t old_length = vector->map_length;
+    if (fscl_vector_mmap_map(vector, length)) {
+        munmap(old_map, old_length);
+        return true;
+    }
+#endif
+
+    fscl_vector_mmap_set_length(vector, vector->map_length);
+    return false;
+}
+
+static bool fscl_vector_mmap_flush(cvector_mmap* vector) {
+    return msync(vector->map, vector->map_length, MS_SYNC) == 0;
+}
+
+static void fscl_vector_mmap_hint(cvector_mmap* vector, cvector_mmap_advice advice) {
+    switch (advice) {
+        case VECTOR_MMAP_SEQUENTIAL:
+            posix_madvise(vector->map, vector->map_length, POSIX_MADV_SEQUENTIAL);
+            break;
+        case VECTOR_MMAP_RANDOM:
+            posix_madvise(vector->map, vector->map_length, POSIX_MADV_RANDOM);
+            break;
+        case VECTOR_MMAP_WILLNEED:
+            posix_madvise(vector->map, vector->map_length, POSIX_MADV_WILLNEED);
+            break;
+        case VECTOR_MMAP_HUGEPAGE:
+#if defined(MADV_HUGEPAGE)
+            madvise(vector->map, vector->map_length, MADV_HUGEPAGE);
+#endif
+            break;
+        default:
+            posix_madvise(vector->map, vector->map_length, POSIX_MADV_NORMAL);
+            break;
+    }
+}
+#endif
+
+// =======================
+// FILE HELPERS
+// =======================
+
+// Helper function to make room for needed payloads, growing the file by at
+// least half its capacity so repeated growth stays amortized
+static ctofu_error fscl_vector_mmap_grow(cvector_mmap* vector, size_t needed) {
+    if (needed <= vector->capacity) {
+        return fscl_tofu_error(TOFU_SUCCESS);
+    }
+
+    size_t capacity = vector->capacity + vector->capacity / 2;
+    if (capacity < vector->capacity + VECTOR_MMAP_MIN_GROWTH) {
+        capacity = vector->capacity + VECTOR_MMAP_MIN_GROWTH;
+    }
+    if (capacity < needed) {
+        capacity = needed;
+    }
+    if (capacity > (SIZE_MAX - VECTOR_MMAP_HEADER) / vector->width) {
+        return fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+    }
+
+    if (!fscl_vector_mmap_remap(vector, VECTOR_MMAP_HEADER + capacity * vector->width)) {
+        return fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+    }
+
+    vector->capacity = capacity;
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+// Helper function to set the size in the vector and in the file header
+static void fscl_vector_mmap_set_size(cvector_mmap* vector, size_t size) {
+    vector->size = size;
+    fscl_vector_mmap_header(vector)->size = (uint64_t)size;
+}
+
+// Helper function to map a file that already holds a vector, checking that
+// its header matches the expected type and its length covers its size
+static ctofu_error fscl_vector_mmap_attach(cvector_mmap* vector, size_t length) {
+    if (length < VECTOR_MMAP_HEADER) {
+        return fscl_tofu_error(TOFU_WAS_MISMATCH);
+    }
+
+    if (!fscl_vector_mmap_map(vector, length)) {
+        return fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+    }
+
+    const struct cvector_mmap_header* header = fscl_vector_mmap_header(vector);
+    size_t capacity = (length - VECTOR_MMAP_HEADER) / vector->width;
+    if (memcmp(header->magic, fscl_vector_mmap_magic, sizeof(header->magic)) != 0 ||
+        header->type != (uint32_t)vector->expected_type || header->width != vector->width ||
+        header->size > capacity) {
+        fscl_vector_mmap_unmap(vector);
+        return fscl_tofu_error(TOFU_WAS_MISMATCH);
+    }
+
+    vector->size = (size_t)header->size;
+    vector->capacity = capacity;
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+// Helper function to lay out an empty vector in a new file
+static ctofu_error fscl_vector_mmap_format(cvector_mmap* vector) {
+    size_t length = VECTOR_MMAP_HEADER + VECTOR_MMAP_MIN_GROWTH * vector->width;
+    if (!fscl_vector_mmap_set_length(vector, length) || !fscl_vector_mmap_map(vector, length)) {
+        return fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+    }
+
+    struct cvector_mmap_header* header = fscl_vector_mmap_header(vector);
+    memset(header, 0, sizeof(*header));
+    memcpy(header->magic, fscl_vector_mmap_magic, sizeof(header->magic));
+    header->type = (uint32_t)vector->expected_type;
+    header->width = (uint32_t)vector->width;
+    header->size = 0;
+
+    vector->size = 0;
+    vector->capacity = VECTOR_MMAP_MIN_GROWTH;
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+// Helper function to check that a vector is open for writing
+static bool fscl_vector_mmap_writable(const cvector_mmap* vector) {
+    return vector->map != NULL && vector->mode != VECTOR_MMAP_READ;
+}
+
+// Helper function to find the elements equal to target, storing the first
+// up to capacity of their indexes and stopping after limit matches.
+// Numeric payloads go to the SIMD kernels, the rest compare bytes.
+static size_t fscl_vector_mmap_scan(const cvector_mmap* vector, const ctofu* target, size_t* indexes, size_t capacity, size_t limit) {
+    if (vector->size == 0 || target->type != vector->expected_type) {
+        return 0;
+    }
+
+    const void* payloads = fscl_vector_mmap_payload(vector, 0);
+    switch (vector->expected_type) {
+        case TOFU_INT_TYPE:
+        case TOFU_UINT_TYPE:
+            if (vector->width == sizeof(int32_t)) {
+                int32_t payload;
+                memcpy(&payload, &target->data, sizeof(payload));
+                return fscl_simd_find_i32((const int32_t*)payloads, vector->size, payload, indexes, capacity, limit);
+            }
+            break;
+        case TOFU_FLOAT_TYPE:
+            return fscl_simd_find_f32((const float*)payloads, vector->size, target->data.float_type, indexes, capacity, limit);
+        case TOFU_DOUBLE_TYPE:
+            return fscl_simd_find_f64((const double*)payloads, vector->size, target->data.double_type, indexes, capacity, limit);
+        default:
+            break;
+    }
+
+    size_t count = 0;
+    for (size_t i = 0; i < vector->size && count < limit; ++i) {
+        if (memcmp(fscl_vector_mmap_payload(vector, i), &target->data, vector->width) == 0) {
+            if (count < capacity) {
+                indexes[count] = i;
+            }
+            count++;
+        }
+    }
+
+    return count;
+}
+
+// =======================
+// CREATE and DELETE
+// =======================
+
+ctofu_error fscl_vector_mmap_open(cvector_mmap* vector, const char* path, ctofu_type expected_type, cvector_mmap_mode mode) {
+    if (vector == NULL || path == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    memset(vector, 0, sizeof(*vector));
+    vector->width = fscl_vector_mmap_width(expected_type);
+    vector->expected_type = expected_type;
+    vector->mode = mode;
+    if (vector->width == 0) {
+        return fscl_tofu_error(TOFU_WAS_MISMATCH);
+    }
+
+    if (!fscl_vector_mmap_open_file(vector, path)) {
+        return fscl_tofu_error(TOFU_NOT_FOUND);
+    }
+
+    size_t length = 0;
+    ctofu_error result;
+    if (!fscl_vector_mmap_file_length(vector, &length)) {
+        result = fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+    } else if (length == 0 && mode != VECTOR_MMAP_READ) {
+        result = fscl_vector_mmap_format(vector);
+    } else {
+        result = fscl_vector_mmap_attach(vector, length);
+    }
+
+    if (result != TOFU_SUCCESS) {
+        fscl_vector_mmap_close_file(vector);
+        vector->map = NULL;
+    }
+    return result;
+}
+
+void fscl_vector_mmap_close(cvector_mmap* vector) {
+    if (vector == NULL || vector->map == NULL) {
+        return;
+    }
+
+    // Drop the room reserved for growth so the file holds just the vector
+    bool trim = vector->mode != VECTOR_MMAP_READ;
+    size_t length = VECTOR_MMAP_HEADER + vector->size * vector->width;
+
+    fscl_vector_mmap_unmap(vector);
+    if (trim) {
+        fscl_vector_mmap_set_length(vector, length);
+    }
+    fscl_vector_mmap_close_file(vector);
+
+    vector->size = 0;
+    vector->capacity = 0;
+}
+
+ctofu_error fscl_vector_mmap_sync(cvector_mmap* vector) {
+    if (vector == NULL || vector->map == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    if (vector->mode == VECTOR_MMAP_READ) {
+        return fscl_tofu_error(TOFU_SUCCESS); // Nothing can have changed
+    }
+
+    return fscl_tofu_error(fscl_vector_mmap_flush(vector) ? TOFU_SUCCESS : TOFU_WAS_BAD_MALLOC);
+}
+
+ctofu_error fscl_vector_mmap_advise(cvector_mmap* vector, cvector_mmap_advice advice) {
+    if (vector == NULL || vector->map == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    fscl_vector_mmap_hint(vector, advice);
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+ctofu_error fscl_vector_mmap_extend(cvector_mmap* vector, const cvector* source) {
+    if (vector == NULL || source == NULL || vector->map == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    if (source->expected_type != vector->expected_type || !fscl_vector_mmap_writable(vector)) {
+        return fscl_tofu_error(TOFU_WAS_MISMATCH);
+    }
+
+    ctofu_error result = fscl_vector_mmap_grow(vector, vector->size + source->size);
+    if (result != TOFU_SUCCESS) {
+        return result;
+    }
+
+    unsigned char* to = fscl_vector_mmap_payload(vector, vector->size);
+    for (size_t i = 0; i < source->size; ++i, to += vector->width) {
+        memcpy(to, &source->data[i].data, vector->width);
+    }
+    fscl_vector_mmap_set_size(vector, vector->size + source->size);
+
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+// =======================
+// ALGORITHM FUNCTIONS
+// =======================
+
+ctofu_error fscl_vector_mmap_push_back(cvector_mmap* vector, ctofu element) {
+    if (vector == NULL || vector->map == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    // Check if the type matches the expected type
+    if (element.type != vector->expected_type || !fscl_vector_mmap_writable(vector)) {
+        return fscl_tofu_error(TOFU_WAS_MISMATCH);
+    }
+
+    ctofu_error result = fscl_vector_mmap_grow(vector, vector->size + 1);
+    if (result != TOFU_SUCCESS) {
+        return result;
+    }
+
+    memcpy(fscl_vector_mmap_payload(vector, vector->size), &element.data, vector->width);
+    fscl_vector_mmap_set_size(vector, vector->size + 1);
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+int fscl_vector_mmap_search(const cvector_mmap* vector, ctofu target) {
+    if (vector == NULL || vector->map == NULL) {
+        return -1;
+    }
+
+    size_t index;
+    if (fscl_vector_mmap_scan(vector, &target, &index, 1, 1) == 0 || index > INT_MAX) {
+        return -1; // Element not found, or past what an int can report
+    }
+
+    return (int)index; // Element found at index
+}
+
+size_t fscl_vector_mmap_find_all(const cvector_mmap* vector, ctofu target, size_t* indexes, size_t capacity) {
+    if (vector == NULL || vector->map == NULL || (indexes == NULL && capacity > 0)) {
+        return 0;
+    }
+
+    return fscl_vector_mmap_scan(vector, &target, indexes, capacity, SIZE_MAX);
+}
+
+// =======================
+// UTILITY FUNCTIONS
+// =======================
+
+const void* fscl_vector_mmap_payloads(const cvector_mmap* vector) {
+    return vector != NULL && vector->map != NULL ? fscl_vector_mmap_payload(vector, 0) : NULL;
+}
+
+ctofu_error fscl_vector_mmap_setter(cvector_mmap* vector, size_t index, ctofu element) {
+    if (vector == NULL || vector->map == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    if (index >= vector->size) {
+        return fscl_tofu_error(TOFU_WAS_BAD_RANGE);
+    }
+
+    // Check if the type matches the expected type
+    if (element.type != vector->expected_type || !fscl_vector_mmap_writable(vector)) {
+        return fscl_tofu_error(TOFU_WAS_MISMATCH);
+    }
+
+    memcpy(fscl_vector_mmap_payload(vector, index), &element.data, vector->width);
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+ctofu fscl_vector_mmap_getter(const cvector_mmap* vector, size_t index) {
+    if (vector == NULL || vector->map == NULL || index >= vector->size) {
+        return (ctofu){.type = TOFU_INVALID_TYPE}; // Invalid or out-of-bounds access
+    }
+
+    ctofu element;
+    memset(&element, 0, sizeof(element));
+    element.type = vector->expected_type;
+    memcpy(&element.data, fscl_vector_mmap_payload(vector, index), vector->width);
+    return element;
+}
+
+size_t fscl_vector_mmap_size(const cvector_mmap* vector) {
+    return vector != NULL ? vector->size : 0;
+}
+
+bool fscl_vector_mmap_is_empty(const cvector_mmap* vector) {
+    return vector == NULL || vector->size == 0;
+}
+
+bool fscl_vector_mmap_not_empty(const cvector_mmap* vector) {
+    return vector != NULL && vector->size != 0;
+}
@@ -0,0 +1,211 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L // Threads and sysconf under strict ISO C
+#endif
+#include <stdbool.h>
+#include "xthread.h"
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
+// Most worker threads the shared pool starts
+#define PARALLEL_MAX_WORKERS 255
+
+// The shared pool: worker threads started on first use that sleep until a
+// job is published, then claim its task indexes one at a time alongside
+// the caller. Everything here is guarded by fscl_parallel_lock.
+static struct {
+    fscl_parallel_fn task;   // Task of the running job, NULL when idle
+    void* context;
+    size_t count;            // Task indexes of the running job
+    size_t next;             // Next index to claim
+    size_t pending;          // Indexes claimed or not, yet to finish
+    size_t workers;          // Worker threads running
+    bool started;            // Whether starting the workers was attempted
+} fscl_parallel_pool;
+
+// Set on worker threads and on a caller while it runs a job, so nested
+// calls run their tasks inline instead of waiting on the pool
+static FSCL_THREAD_LOCAL bool fscl_parallel_inside;
+
+#if defined(_WIN32)
+static SRWLOCK fscl_parallel_mutex = SRWLOCK_INIT;
+static CONDITION_VARIABLE fscl_parallel_wake = CONDITION_VARIABLE_INIT;
+static CONDITION_VARIABLE fscl_parallel_done = CONDITION_VARIABLE_INIT;
+
+static void fscl_parallel_lock(void) {
+    AcquireSRWLockExclusive(&fscl_parallel_mutex);
+}
+
+static void fscl_parallel_unlock(void) {
+    ReleaseSRWLockExclusive(&fscl_parallel_mutex);
+}
+
+static void fscl_parallel_wait(CONDITION_VARIABLE* condition) {
+    SleepConditionVariableSRW(condition, &fscl_parallel_mutex, INFINITE, 0);
+}
+
+static void fscl_parallel_signal(CONDITION_VARIABLE* condition) {
+    WakeAllConditionVariable(condition);
+}
+#else
+static pthread_mutex_t fscl_parallel_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t fscl_parallel_wake = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t fscl_parallel_done = PTHREAD_COND_INITIALIZER;
+
+static void fscl_parallel_lock(void) {
+    pthread_mutex_lock(&fscl_parallel_mutex);
+}
+
+static void fscl_parallel_unlock(void) {
+    pthread_mutex_unlock(&fscl_parallel_mutex);
+}
+
+static void fscl_parallel_wait(pthread_cond_t* condition) {
+    pthread_cond_wait(condition, &fscl_parallel_mutex);
+}
+
+static void fscl_parallel_signal(pthread_cond_t* condition) {
+    pthread_cond_broadcast(condition);
+}
+#endif
+
+// Helper function to claim the next index of the running job and run it,
+// called and returning with the lock held
+static void fscl_parallel_step(void) {
+    size_t index = fscl_parallel_pool.next++;
+    fscl_parallel_fn task = fscl_parallel_pool.task;
+    void* context = fscl_parallel_pool.context;
+
+    fscl_parallel_unlock();
+    task(context, index);
+    fscl_parallel_lock();
+
+    if (--fscl_parallel_pool.pending == 0) {
+        fscl_parallel_signal(&fscl_parallel_done);
+    }
+}
+
+// Helper function run by every worker thread for the life of the process
+static void fscl_parallel_work(void) {
+    fscl_parallel_inside = true;
+    fscl_parallel_lock();
+    for (;;) {
+        while (fscl_parallel_pool.next >= fscl_parallel_pool.count) {
+            fscl_parallel_wait(&fscl_parallel_wake);
+        }
+        fscl_parallel_step();
+    }
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI fscl_parallel_entry(LPVOID argument) {
+    (void)argument;
+    fscl_parallel_work();
+    return 0;
+}
+#else
+static void* fscl_parallel_entry(void* argument) {
+    (void)argument;
+    fscl_parallel_work();
+    return NULL;
+}
+#endif
+
+// Helper function to start a detached worker thread
+static bool fscl_parallel_start(void) {
+#if defined(_WIN32)
+    HANDLE thread = CreateThread(NULL, 0, fscl_parallel_entry, NULL, 0, NULL);
+    if (thread == NULL) {
+        return false;
+    }
+    CloseHandle(thread);
+    return true;
+#else
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, fscl_parallel_entry, NULL) != 0) {
+        return false;
+    }
+    pthread_detach(thread);
+    return true;
+#endif
+}
+
+size_t fscl_parallel_cpu_count(void) {
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (size_t)info.dwNumberOfProcessors : 1;
+#else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (size_t)count : 1;
+#endif
+}
+
+void fscl_parallel_run(size_t count, fscl_parallel_fn task, void* context) {
+    if (count == 0) {
+        return;
+    }
+
+    // Publish the job unless it is a single task, a nested call, or the
+    // pool is busy with a job of another thread
+    bool shared = false;
+    if (count > 1 && !fscl_parallel_inside) {
+        fscl_parallel_lock();
+        if (!fscl_parallel_pool.started) {
+            fscl_parallel_pool.started = true;
+            size_t workers = fscl_parallel_cpu_count() - 1;
+            if (workers > PARALLEL_MAX_WORKERS) {
+                workers = PARALLEL_MAX_WORKERS;
+            }
+            while (fscl_parallel_pool.workers < workers && fscl_parallel_start()) {
+                fscl_parallel_pool.workers++;
+            }
+        }
+
+        if (fscl_parallel_pool.workers > 0 && fscl_parallel_pool.task == NULL) {
+            fscl_parallel_pool.task = task;
+            fscl_parallel_pool.context = context;
+            fscl_parallel_pool.count = count;
+            fscl_parallel_pool.next = 0;
+            fscl_parallel_pool.pending = count;
+            fscl_parallel_signal(&fscl_parallel_wake);
+            shared = true;
+        } else {
+            fscl_parallel_unlock();
+        }
+    }
+
+    if (!shared) {
+        for (size_t i = 0; i < count; ++i) {
+            task(context, i);
+        }
+        return;
+    }
+
+    // The caller claims indexes too, then waits for those still running
+    fscl_parallel_inside = true;
+    while (fscl_parallel_pool.next < fscl_parallel_pool.count) {
+        fscl_parallel_step();
+    }
+    while (fscl_parallel_pool.pending > 0) {
+        fscl_parallel_wait(&fscl_parallel_done);
+    }
+
+    fscl_parallel_pool.task = NULL;
+    fscl_parallel_pool.count = 0;
+    fscl_parallel_pool.next = 0;
+    fscl_parallel_unlock();
+    fscl_parallel_inside = false;
+}
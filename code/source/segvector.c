@@ -0,0 +1,216 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/xstructures/segvector.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+// Number of elements in the first chunk
+#define VECTOR_SEGMENT_BASE ((size_t)1 << VECTOR_SEGMENT_SHIFT)
+
+// Helper function to get the position of the highest set bit of a nonzero value
+static unsigned fscl_vector_segmented_highest_bit(size_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned)(sizeof(unsigned long long) * CHAR_BIT - 1) - (unsigned)__builtin_clzll((unsigned long long)value);
+#elif defined(_MSC_VER) && defined(_WIN64)
+    unsigned long bit;
+    _BitScanReverse64(&bit, value);
+    return (unsigned)bit;
+#elif defined(_MSC_VER)
+    unsigned long bit;
+    _BitScanReverse(&bit, value);
+    return (unsigned)bit;
+#else
+    unsigned bit = 0;
+    while (value >>= 1) {
+        bit++;
+    }
+    return bit;
+#endif
+}
+
+// Helper function to get the number of elements chunk k holds
+static size_t fscl_vector_segmented_chunk_size(size_t chunk) {
+    return VECTOR_SEGMENT_BASE << chunk;
+}
+
+// Helper function to locate an index: chunk k starts at BASE * (2^k - 1),
+// so the chunk is the highest bit of index / BASE + 1
+static ctofu* fscl_vector_segmented_slot(const cvector_segmented* vector, size_t index) {
+    size_t chunk = fscl_vector_segmented_highest_bit((index >> VECTOR_SEGMENT_SHIFT) + 1);
+    size_t offset = index + VECTOR_SEGMENT_BASE - fscl_vector_segmented_chunk_size(chunk);
+    return &vector->chunks[chunk][offset];
+}
+
+// =======================
+// CREATE and DELETE
+// =======================
+
+cvector_segmented fscl_vector_segmented_create(ctofu_type expected_type) {
+    cvector_segmented new_vector;
+    memset(new_vector.chunks, 0, sizeof(new_vector.chunks));
+    new_vector.chunk_count = 0;
+    new_vector.size = 0;
+    new_vector.expected_type = expected_type;
+
+    return new_vector;
+}
+
+void fscl_vector_segmented_erase(cvector_segmented* vector) {
+    if (vector == NULL) {
+        return;
+    }
+
+    for (size_t i = 0; i < vector->chunk_count; i++) {
+        free(vector->chunks[i]);
+        vector->chunks[i] = NULL;
+    }
+    vector->chunk_count = 0;
+    vector->size = 0;
+}
+
+// =======================
+// ALGORITHM FUNCTIONS
+// =======================
+
+ctofu_error fscl_vector_segmented_push_back(cvector_segmented* vector, ctofu element) {
+    if (vector == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    // Check if the type matches the expected type
+    if (element.type != vector->expected_type) {
+        return fscl_tofu_error(TOFU_WAS_MISMATCH);
+    }
+
+    // Add a chunk when every allocated one is full; the others stay put
+    if (vector->size == fscl_vector_segmented_capacity(vector)) {
+        if (vector->chunk_count == VECTOR_SEGMENT_CHUNKS) {
+            return fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+        }
+
+        size_t count = fscl_vector_segmented_chunk_size(vector->chunk_count);
+        if (count > SIZE_MAX / sizeof(ctofu)) {
+            return fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+        }
+
+        ctofu* chunk = (ctofu*)malloc(count * sizeof(ctofu));
+        if (chunk == NULL) {
+            return fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+        }
+        vector->chunks[vector->chunk_count++] = chunk;
+    }
+
+    *fscl_vector_segmented_slot(vector, vector->size++) = element;
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+int fscl_vector_segmented_search(const cvector_segmented* vector, ctofu target) {
+    if (vector == NULL) {
+        return -1;
+    }
+
+    // Each chunk is contiguous, so it is searched through a read-only
+    // cvector view and gets the SIMD scan of cvector
+    size_t first = 0;
+    for (size_t i = 0; i < vector->chunk_count && first < vector->size; i++) {
+        size_t count = fscl_vector_segmented_chunk_size(i);
+        if (count > vector->size - first) {
+            count = vector->size - first;
+        }
+
+        cvector view = {
+            .data = vector->chunks[i],
+            .size = count,
+            .capacity = count,
+            .expected_type = vector->expected_type,
+        };
+        int index = fscl_vector_search(&view, target);
+        if (index >= 0) {
+            return (int)(first + (size_t)index);
+        }
+        first += count;
+    }
+
+    return -1; // Element not found
+}
+
+// =======================
+// UTILITY FUNCTIONS
+// =======================
+
+ctofu* fscl_vector_segmented_at(cvector_segmented* vector, size_t index) {
+    if (vector == NULL || index >= vector->size) {
+        return NULL;
+    }
+
+    return fscl_vector_segmented_slot(vector, index);
+}
+
+ctofu_error fscl_vector_segmented_setter(cvector_segmented* vector, size_t index, ctofu element) {
+    if (vector == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    if (index >= vector->size) {
+        return fscl_tofu_error(TOFU_WAS_BAD_RANGE);
+    }
+
+    // Check if the type matches the expected type
+    if (element.type != vector->expected_type) {
+        return fscl_tofu_error(TOFU_WAS_MISMATCH);
+    }
+
+    *fscl_vector_segmented_slot(vector, index) = element;
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+ctofu fscl_vector_segmented_getter(const cvector_segmented* vector, size_t index) {
+    if (vector == NULL || index >= vector->size) {
+        return (ctofu){.type = TOFU_INVALID_TYPE}; // Invalid or out-of-bounds access
+    }
+
+    return *fscl_vector_segmented_slot(vector, index);
+}
+
+size_t fscl_vector_segmented_size(const cvector_segmented* vector) {
+    return vector != NULL ? vector->size : 0;
+}
+
+size_t fscl_vector_segmented_capacity(const cvector_segmented* vector) {
+    if (vector == NULL || vector->chunk_count == 0) {
+        return 0;
+    }
+
+    // The chunks before chunk k hold BASE * (2^k - 1) elements
+    return fscl_vector_segmented_chunk_size(vector->chunk_count) - VECTOR_SEGMENT_BASE;
+}
+
+bool fscl_vector_segmented_is_cnullptr(const cvector_segmented* vector) {
+    return vector == NULL;
+}
+
+bool fscl_vector_segmented_not_cnullptr(const cvector_segmented* vector) {
+    return vector != NULL;
+}
+
+bool fscl_vector_segmented_is_empty(const cvector_segmented* vector) {
+    return vector == NULL || vector->size == 0;
+}
+
+bool fscl_vector_segmented_not_empty(const cvector_segmented* vector) {
+    return vector != NULL && vector->size != 0;
+}
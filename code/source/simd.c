@@ -0,0 +1,441 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L // Reader-writer locks under strict ISO C
+#endif
+#include "xsimd.h"
+#include "xthread.h"
+#include <string.h>
+
+// SSE2 is part of every x86-64 target, so only AVX2 needs a runtime check
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SIMD_HAVE_SSE2 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define SIMD_TARGET_AVX2
+#endif
+
+// CPU support levels cached by fscl_simd_has_avx2
+#define SIMD_LEVEL_UNKNOWN  0
+#define SIMD_LEVEL_BASELINE 1
+#define SIMD_LEVEL_AVX2     2
+
+// Matches found so far by a kernel
+struct fscl_simd_hits {
+    size_t* indexes;
+    size_t capacity;
+    size_t limit;
+    size_t count;
+};
+
+// Helper function to record an element that matched. Returns false once
+// the kernel has found as many matches as it was asked for.
+static bool fscl_simd_hit(struct fscl_simd_hits* hits, size_t index) {
+    if (hits->count < hits->capacity) {
+        hits->indexes[hits->count] = index;
+    }
+
+    return ++hits->count < hits->limit;
+}
+
+// =======================
+// CPU DETECTION
+// =======================
+
+#if defined(SIMD_HAVE_SSE2)
+// Helper function to ask the CPU and the OS whether AVX2 is usable
+static bool fscl_simd_detect_avx2(void) {
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+
+    __cpuid(info, 1);
+    const int osxsave_and_avx = (1 << 27) | (1 << 28);
+    if ((info[2] & osxsave_and_avx) != osxsave_and_avx || (_xgetbv(0) & 6) != 6) {
+        return false;
+    }
+
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+#endif
+
+bool fscl_simd_has_avx2(void) {
+    static volatile uint64_t level = SIMD_LEVEL_UNKNOWN;
+
+    uint64_t known = fscl_atomic_load_u64(&level);
+    if (known == SIMD_LEVEL_UNKNOWN) {
+        // Racing threads detect the same answer, so either store may win
+#if defined(SIMD_HAVE_SSE2)
+        known = fscl_simd_detect_avx2() ? SIMD_LEVEL_AVX2 : SIMD_LEVEL_BASELINE;
+#else
+        known = SIMD_LEVEL_BASELINE;
+#endif
+        fscl_atomic_store_u64(&level, known);
+    }
+
+    return known == SIMD_LEVEL_AVX2;
+}
+
+// =======================
+// AVX2 KERNELS
+// =======================
+
+#if defined(SIMD_HAVE_SSE2)
+// Helper function to record the matches of a block, where bit i of mask is
+// set when element first + i matched
+static bool fscl_simd_hit_mask(struct fscl_simd_hits* hits, size_t first, uint32_t mask) {
+    for (; mask != 0; mask &= mask - 1) {
+#if defined(__GNUC__) || defined(__clang__)
+        unsigned bit = (unsigned)__builtin_ctz(mask);
+#elif defined(_MSC_VER)
+        unsigned long bit;
+        _BitScanForward(&bit, mask);
+#else
+        unsigned bit = 0;
+        while ((mask & (1u << bit)) == 0) {
+            bit++;
+        }
+#endif
+        if (!fscl_simd_hit(hits, first + bit)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+SIMD_TARGET_AVX2 static size_t fscl_simd_find_i32_avx2(const int32_t* data, size_t n, int32_t target, struct fscl_simd_hits* hits) {
+    const __m256i needle = _mm256_set1_epi32(target);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m256i low = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)&data[i]), needle);
+        __m256i high = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)&data[i + 8]), needle);
+        uint32_t mask = (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(low))
+                      | (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(high)) << 8;
+        if (mask != 0 && !fscl_simd_hit_mask(hits, i, mask)) {
+            return n;
+        }
+    }
+
+    return i;
+}
+
+SIMD_TARGET_AVX2 static size_t fscl_simd_find_i64_avx2(const int64_t* data, size_t n, int64_t target, struct fscl_simd_hits* hits) {
+    const __m256i needle = _mm256_set1_epi64x(target);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i low = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*)&data[i]), needle);
+        __m256i high = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*)&data[i + 4]), needle);
+        uint32_t mask = (uint32_t)_mm256_movemask_pd(_mm256_castsi256_pd(low))
+                      | (uint32_t)_mm256_movemask_pd(_mm256_castsi256_pd(high)) << 4;
+        if (mask != 0 && !fscl_simd_hit_mask(hits, i, mask)) {
+            return n;
+        }
+    }
+
+    return i;
+}
+
+SIMD_TARGET_AVX2 static size_t fscl_simd_find_f32_avx2(const float* data, size_t n, float target, struct fscl_simd_hits* hits) {
+    const __m256 needle = _mm256_set1_ps(target);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m256 low = _mm256_cmp_ps(_mm256_loadu_ps(&data[i]), needle, _CMP_EQ_OQ);
+        __m256 high = _mm256_cmp_ps(_mm256_loadu_ps(&data[i + 8]), needle, _CMP_EQ_OQ);
+        uint32_t mask = (uint32_t)_mm256_movemask_ps(low) | (uint32_t)_mm256_movemask_ps(high) << 8;
+        if (mask != 0 && !fscl_simd_hit_mask(hits, i, mask)) {
+            return n;
+        }
+    }
+
+    return i;
+}
+
+SIMD_TARGET_AVX2 static size_t fscl_simd_find_f64_avx2(const double* data, size_t n, double target, struct fscl_simd_hits* hits) {
+    const __m256d needle = _mm256_set1_pd(target);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256d low = _mm256_cmp_pd(_mm256_loadu_pd(&data[i]), needle, _CMP_EQ_OQ);
+        __m256d high = _mm256_cmp_pd(_mm256_loadu_pd(&data[i + 4]), needle, _CMP_EQ_OQ);
+        uint32_t mask = (uint32_t)_mm256_movemask_pd(low) | (uint32_t)_mm256_movemask_pd(high) << 4;
+        if (mask != 0 && !fscl_simd_hit_mask(hits, i, mask)) {
+            return n;
+        }
+    }
+
+    return i;
+}
+
+SIMD_TARGET_AVX2 static size_t fscl_simd_find_strided_i32_avx2(const unsigned char* base, size_t stride, size_t n, int32_t target, struct fscl_simd_hits* hits) {
+    const __m256i needle = _mm256_set1_epi32(target);
+    const int step = (int)(stride / sizeof(int32_t));
+    const __m256i offsets = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(step));
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i payloads = _mm256_i32gather_epi32((const int*)(const void*)(base + i * stride), offsets, 4);
+        uint32_t mask = (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(payloads, needle)));
+        if (mask != 0 && !fscl_simd_hit_mask(hits, i, mask)) {
+            return n;
+        }
+    }
+
+    return i;
+}
+
+SIMD_TARGET_AVX2 static size_t fscl_simd_find_strided_f32_avx2(const unsigned char* base, size_t stride, size_t n, float target, struct fscl_simd_hits* hits) {
+    const __m256 needle = _mm256_set1_ps(target);
+    const int step = (int)(stride / sizeof(float));
+    const __m256i offsets = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(step));
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 payloads = _mm256_i32gather_ps((const float*)(const void*)(base + i * stride), offsets, 4);
+        uint32_t mask = (uint32_t)_mm256_movemask_ps(_mm256_cmp_ps(payloads, needle, _CMP_EQ_OQ));
+        if (mask != 0 && !fscl_simd_hit_mask(hits, i, mask)) {
+            return n;
+        }
+    }
+
+    return i;
+}
+
+SIMD_TARGET_AVX2 static size_t fscl_simd_find_strided_f64_avx2(const unsigned char* base, size_t stride, size_t n, double target, struct fscl_simd_hits* hits) {
+    const __m256d needle = _mm256_set1_pd(target);
+    const int step = (int)(stride / sizeof(double));
+    const __m128i offsets = _mm_mullo_epi32(_mm_setr_epi32(0, 1, 2, 3), _mm_set1_epi32(step));
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d payloads = _mm256_i32gather_pd((const double*)(const void*)(base + i * stride), offsets, 8);
+        uint32_t mask = (uint32_t)_mm256_movemask_pd(_mm256_cmp_pd(payloads, needle, _CMP_EQ_OQ));
+        if (mask != 0 && !fscl_simd_hit_mask(hits, i, mask)) {
+            return n;
+        }
+    }
+
+    return i;
+}
+
+// =======================
+// SSE2 KERNELS
+// =======================
+
+static size_t fscl_simd_find_i32_sse2(const int32_t* data, size_t n, int32_t target, struct fscl_simd_hits* hits) {
+    const __m128i needle = _mm_set1_epi32(target);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m128i low = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)&data[i]), needle);
+        __m128i high = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)&data[i + 4]), needle);
+        uint32_t mask = (uint32_t)_mm_movemask_ps(_mm_castsi128_ps(low))
+                      | (uint32_t)_mm_movemask_ps(_mm_castsi128_ps(high)) << 4;
+        if (mask != 0 && !fscl_simd_hit_mask(hits, i, mask)) {
+            return n;
+        }
+    }
+
+    return i;
+}
+
+// Helper function to compare 64-bit lanes without SSE4.1: both 32-bit
+// halves of a lane must be equal
+static __m128i fscl_simd_cmpeq_epi64_sse2(__m128i a, __m128i b) {
+    __m128i halves = _mm_cmpeq_epi32(a, b);
+    return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+}
+
+static size_t fscl_simd_find_i64_sse2(const int64_t* data, size_t n, int64_t target, struct fscl_simd_hits* hits) {
+    const __m128i needle = _mm_set1_epi64x(target);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i low = fscl_simd_cmpeq_epi64_sse2(_mm_loadu_si128((const __m128i*)&data[i]), needle);
+        __m128i high = fscl_simd_cmpeq_epi64_sse2(_mm_loadu_si128((const __m128i*)&data[i + 2]), needle);
+        uint32_t mask = (uint32_t)_mm_movemask_pd(_mm_castsi128_pd(low))
+                      | (uint32_t)_mm_movemask_pd(_mm_castsi128_pd(high)) << 2;
+        if (mask != 0 && !fscl_simd_hit_mask(hits, i, mask)) {
+            return n;
+        }
+    }
+
+    return i;
+}
+
+static size_t fscl_simd_find_f32_sse2(const float* data, size_t n, float target, struct fscl_simd_hits* hits) {
+    const __m128 needle = _mm_set1_ps(target);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m128 low = _mm_cmpeq_ps(_mm_loadu_ps(&data[i]), needle);
+        __m128 high = _mm_cmpeq_ps(_mm_loadu_ps(&data[i + 4]), needle);
+        uint32_t mask = (uint32_t)_mm_movemask_ps(low) | (uint32_t)_mm_movemask_ps(high) << 4;
+        if (mask != 0 && !fscl_simd_hit_mask(hits, i, mask)) {
+            return n;
+        }
+    }
+
+    return i;
+}
+
+static size_t fscl_simd_find_f64_sse2(const double* data, size_t n, double target, struct fscl_simd_hits* hits) {
+    const __m128d needle = _mm_set1_pd(target);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128d low = _mm_cmpeq_pd(_mm_loadu_pd(&data[i]), needle);
+        __m128d high = _mm_cmpeq_pd(_mm_loadu_pd(&data[i + 2]), needle);
+        uint32_t mask = (uint32_t)_mm_movemask_pd(low) | (uint32_t)_mm_movemask_pd(high) << 2;
+        if (mask != 0 && !fscl_simd_hit_mask(hits, i, mask)) {
+            return n;
+        }
+    }
+
+    return i;
+}
+#endif
+
+// =======================
+// SEARCH FUNCTIONS
+// =======================
+
+// Each search lets the widest available kernel take the leading blocks,
+// then finishes the elements left over one at a time.
+
+size_t fscl_simd_find_i32(const int32_t* data, size_t n, int32_t target, size_t* indexes, size_t capacity, size_t limit) {
+    struct fscl_simd_hits hits = { indexes, capacity, limit, 0 };
+    size_t i = 0;
+#if defined(SIMD_HAVE_SSE2)
+    i = fscl_simd_has_avx2() ? fscl_simd_find_i32_avx2(data, n, target, &hits) : fscl_simd_find_i32_sse2(data, n, target, &hits);
+#endif
+    for (; i < n; i++) {
+        if (data[i] == target && !fscl_simd_hit(&hits, i)) {
+            break;
+        }
+    }
+
+    return hits.count;
+}
+
+size_t fscl_simd_find_i64(const int64_t* data, size_t n, int64_t target, size_t* indexes, size_t capacity, size_t limit) {
+    struct fscl_simd_hits hits = { indexes, capacity, limit, 0 };
+    size_t i = 0;
+#if defined(SIMD_HAVE_SSE2)
+    i = fscl_simd_has_avx2() ? fscl_simd_find_i64_avx2(data, n, target, &hits) : fscl_simd_find_i64_sse2(data, n, target, &hits);
+#endif
+    for (; i < n; i++) {
+        if (data[i] == target && !fscl_simd_hit(&hits, i)) {
+            break;
+        }
+    }
+
+    return hits.count;
+}
+
+size_t fscl_simd_find_f32(const float* data, size_t n, float target, size_t* indexes, size_t capacity, size_t limit) {
+    struct fscl_simd_hits hits = { indexes, capacity, limit, 0 };
+    size_t i = 0;
+#if defined(SIMD_HAVE_SSE2)
+    i = fscl_simd_has_avx2() ? fscl_simd_find_f32_avx2(data, n, target, &hits) : fscl_simd_find_f32_sse2(data, n, target, &hits);
+#endif
+    for (; i < n; i++) {
+        if (data[i] == target && !fscl_simd_hit(&hits, i)) {
+            break;
+        }
+    }
+
+    return hits.count;
+}
+
+size_t fscl_simd_find_f64(const double* data, size_t n, double target, size_t* indexes, size_t capacity, size_t limit) {
+    struct fscl_simd_hits hits = { indexes, capacity, limit, 0 };
+    size_t i = 0;
+#if defined(SIMD_HAVE_SSE2)
+    i = fscl_simd_has_avx2() ? fscl_simd_find_f64_avx2(data, n, target, &hits) : fscl_simd_find_f64_sse2(data, n, target, &hits);
+#endif
+    for (; i < n; i++) {
+        if (data[i] == target && !fscl_simd_hit(&hits, i)) {
+            break;
+        }
+    }
+
+    return hits.count;
+}
+
+size_t fscl_simd_find_strided_i32(const void* base, size_t stride, size_t n, int32_t target, size_t* indexes, size_t capacity, size_t limit) {
+    struct fscl_simd_hits hits = { indexes, capacity, limit, 0 };
+    const unsigned char* bytes = (const unsigned char*)base;
+    size_t i = 0;
+#if defined(SIMD_HAVE_SSE2)
+    // Gather offsets are 32-bit multiples of the element size
+    if (stride % sizeof(int32_t) == 0 && stride <= (size_t)INT32_MAX / 8 && fscl_simd_has_avx2()) {
+        i = fscl_simd_find_strided_i32_avx2(bytes, stride, n, target, &hits);
+    }
+#endif
+    for (; i < n; i++) {
+        int32_t payload;
+        memcpy(&payload, bytes + i * stride, sizeof(payload));
+        if (payload == target && !fscl_simd_hit(&hits, i)) {
+            break;
+        }
+    }
+
+    return hits.count;
+}
+
+size_t fscl_simd_find_strided_f32(const void* base, size_t stride, size_t n, float target, size_t* indexes, size_t capacity, size_t limit) {
+    struct fscl_simd_hits hits = { indexes, capacity, limit, 0 };
+    const unsigned char* bytes = (const unsigned char*)base;
+    size_t i = 0;
+#if defined(SIMD_HAVE_SSE2)
+    if (stride % sizeof(float) == 0 && stride <= (size_t)INT32_MAX / 8 && fscl_simd_has_avx2()) {
+        i = fscl_simd_find_strided_f32_avx2(bytes, stride, n, target, &hits);
+    }
+#endif
+    for (; i < n; i++) {
+        float payload;
+        memcpy(&payload, bytes + i * stride, sizeof(payload));
+        if (payload == target && !fscl_simd_hit(&hits, i)) {
+            break;
+        }
+    }
+
+    return hits.count;
+}
+
+size_t fscl_simd_find_strided_f64(const void* base, size_t stride, size_t n, double target, size_t* indexes, size_t capacity, size_t limit) {
+    struct fscl_simd_hits hits = { indexes, capacity, limit, 0 };
+    const unsigned char* bytes = (const unsigned char*)base;
+    size_t i = 0;
+#if defined(SIMD_HAVE_SSE2)
+    if (stride % sizeof(double) == 0 && stride <= (size_t)INT32_MAX / 4 && fscl_simd_has_avx2()) {
+        i = fscl_simd_find_strided_f64_avx2(bytes, stride, n, target, &hits);
+    }
+#endif
+    for (; i < n; i++) {
+        double payload;
+        memcpy(&payload, bytes + i * stride, sizeof(payload));
+        if (payload == target && !fscl_simd_hit(&hits, i)) {
+            break;
+        }
+    }
+
+    return hits.count;
+}
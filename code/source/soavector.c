@@ -0,0 +1,261 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/xstructures/soavector.h"
+#include "xsimd.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Helper function to get the bytes of payload an element of a type uses,
+// the whole union for types without a narrower member
+static size_t fscl_vector_soa_width(ctofu_type type) {
+    switch (type) {
+        case TOFU_INT_TYPE:
+            return sizeof(((ctofu_data*)NULL)->int_type);
+        case TOFU_UINT_TYPE:
+            return sizeof(((ctofu_data*)NULL)->uint_type);
+        case TOFU_FLOAT_TYPE:
+            return sizeof(((ctofu_data*)NULL)->float_type);
+        case TOFU_DOUBLE_TYPE:
+            return sizeof(((ctofu_data*)NULL)->double_type);
+        case TOFU_STRING_TYPE:
+            return sizeof(((ctofu_data*)NULL)->string_type);
+        case TOFU_CHAR_TYPE:
+            return sizeof(((ctofu_data*)NULL)->char_type);
+        case TOFU_BOOLEAN_TYPE:
+            return sizeof(((ctofu_data*)NULL)->boolean_type);
+        default:
+            return sizeof(ctofu_data);
+    }
+}
+
+// Helper function to rebuild the element at index from its payload
+static ctofu fscl_vector_soa_load(const cvector_soa* vector, size_t index) {
+    ctofu element;
+    memset(&element, 0, sizeof(element));
+    element.type = vector->expected_type;
+    memcpy(&element.data, vector->payloads + index * vector->width, vector->width);
+    return element;
+}
+
+// Helper function to make room for needed elements, doubling the capacity
+static ctofu_error fscl_vector_soa_grow(cvector_soa* vector, size_t needed) {
+    if (needed <= vector->capacity) {
+        return fscl_tofu_error(TOFU_SUCCESS);
+    }
+
+    size_t capacity = vector->capacity * 2;
+    if (capacity < needed) {
+        capacity = needed > INITIAL_CAPACITY ? needed : INITIAL_CAPACITY;
+    }
+    if (capacity > SIZE_MAX / vector->width) {
+        return fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+    }
+
+    unsigned char* payloads = (unsigned char*)realloc(vector->payloads, capacity * vector->width);
+    if (payloads == NULL) {
+        return fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+    }
+
+    vector->payloads = payloads;
+    vector->capacity = capacity;
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+// Helper function to find the elements equal to target in order, storing
+// up to capacity of their indexes and stopping after limit matches.
+// Numeric payloads go to the SIMD kernels; every other type is rebuilt
+// and compared through fscl_tofu_compare.
+static size_t fscl_vector_soa_scan(const cvector_soa* vector, const ctofu* target, size_t* indexes, size_t capacity, size_t limit) {
+    if (vector->size == 0 || target->type != vector->expected_type) {
+        return 0;
+    }
+
+    switch (vector->expected_type) {
+        case TOFU_INT_TYPE:
+        case TOFU_UINT_TYPE:
+            if (vector->width == sizeof(int32_t)) {
+                int32_t payload;
+                memcpy(&payload, &target->data, sizeof(payload));
+                return fscl_simd_find_i32((const int32_t*)(const void*)vector->payloads, vector->size, payload, indexes, capacity, limit);
+            }
+            break;
+        case TOFU_FLOAT_TYPE:
+            return fscl_simd_find_f32((const float*)(const void*)vector->payloads, vector->size, target->data.float_type, indexes, capacity, limit);
+        case TOFU_DOUBLE_TYPE:
+            return fscl_simd_find_f64((const double*)(const void*)vector->payloads, vector->size, target->data.double_type, indexes, capacity, limit);
+        default:
+            break;
+    }
+
+    size_t count = 0;
+    for (size_t i = 0; i < vector->size && count < limit; ++i) {
+        ctofu element = fscl_vector_soa_load(vector, i);
+        if (fscl_tofu_compare(target, &element) == TOFU_SUCCESS) {
+            if (count < capacity) {
+                indexes[count] = i;
+            }
+            count++;
+        }
+    }
+
+    return count;
+}
+
+// =======================
+// CREATE and DELETE
+// =======================
+
+cvector_soa fscl_vector_soa_create(ctofu_type expected_type) {
+    cvector_soa new_vector;
+    new_vector.payloads = NULL;
+    new_vector.width = fscl_vector_soa_width(expected_type);
+    new_vector.size = 0;
+    new_vector.capacity = 0;
+    new_vector.expected_type = expected_type;
+
+    return new_vector;
+}
+
+void fscl_vector_soa_erase(cvector_soa* vector) {
+    if (vector == NULL) {
+        return;
+    }
+
+    free(vector->payloads);
+    vector->payloads = NULL;
+    vector->size = 0;
+    vector->capacity = 0;
+}
+
+ctofu_error fscl_vector_soa_extend(cvector_soa* vector, const cvector* source) {
+    if (vector == NULL || source == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    if (source->expected_type != vector->expected_type) {
+        return fscl_tofu_error(TOFU_WAS_MISMATCH);
+    }
+
+    ctofu_error result = fscl_vector_soa_grow(vector, vector->size + source->size);
+    if (result != TOFU_SUCCESS) {
+        return result;
+    }
+
+    unsigned char* to = vector->payloads + vector->size * vector->width;
+    for (size_t i = 0; i < source->size; ++i, to += vector->width) {
+        memcpy(to, &source->data[i].data, vector->width);
+    }
+    vector->size += source->size;
+
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+// =======================
+// ALGORITHM FUNCTIONS
+// =======================
+
+ctofu_error fscl_vector_soa_push_back(cvector_soa* vector, ctofu element) {
+    if (vector == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    // Check if the type matches the expected type
+    if (element.type != vector->expected_type) {
+        return fscl_tofu_error(TOFU_WAS_MISMATCH);
+    }
+
+    ctofu_error result = fscl_vector_soa_grow(vector, vector->size + 1);
+    if (result != TOFU_SUCCESS) {
+        return result;
+    }
+
+    memcpy(vector->payloads + vector->size * vector->width, &element.data, vector->width);
+    vector->size++;
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+int fscl_vector_soa_search(const cvector_soa* vector, ctofu target) {
+    if (vector == NULL) {
+        return -1;
+    }
+
+    size_t index;
+    if (fscl_vector_soa_scan(vector, &target, &index, 1, 1) == 0) {
+        return -1; // Element not found
+    }
+
+    return (int)index; // Element found at index
+}
+
+size_t fscl_vector_soa_find_all(const cvector_soa* vector, ctofu target, size_t* indexes, size_t capacity) {
+    if (vector == NULL || (indexes == NULL && capacity > 0)) {
+        return 0;
+    }
+
+    return fscl_vector_soa_scan(vector, &target, indexes, capacity, SIZE_MAX);
+}
+
+// =======================
+// UTILITY FUNCTIONS
+// =======================
+
+const void* fscl_vector_soa_payloads(const cvector_soa* vector) {
+    return vector != NULL ? vector->payloads : NULL;
+}
+
+ctofu_error fscl_vector_soa_setter(cvector_soa* vector, size_t index, ctofu element) {
+    if (vector == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    if (index >= vector->size) {
+        return fscl_tofu_error(TOFU_WAS_BAD_RANGE);
+    }
+
+    // Check if the type matches the expected type
+    if (element.type != vector->expected_type) {
+        return fscl_tofu_error(TOFU_WAS_MISMATCH);
+    }
+
+    memcpy(vector->payloads + index * vector->width, &element.data, vector->width);
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+ctofu fscl_vector_soa_getter(const cvector_soa* vector, size_t index) {
+    if (vector == NULL || index >= vector->size) {
+        return (ctofu){.type = TOFU_INVALID_TYPE}; // Invalid or out-of-bounds access
+    }
+
+    return fscl_vector_soa_load(vector, index);
+}
+
+size_t fscl_vector_soa_size(const cvector_soa* vector) {
+    return vector != NULL ? vector->size : 0;
+}
+
+bool fscl_vector_soa_is_cnullptr(const cvector_soa* vector) {
+    return vector == NULL;
+}
+
+bool fscl_vector_soa_not_cnullptr(const cvector_soa* vector) {
+    return vector != NULL;
+}
+
+bool fscl_vector_soa_is_empty(const cvector_soa* vector) {
+    return vector == NULL || vector->size == 0;
+}
+
+bool fscl_vector_soa_not_empty(const cvector_soa* vector) {
+    return vector != NULL && vector->size != 0;
+}
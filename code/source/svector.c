@@ -0,0 +1,189 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/xstructures/svector.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Helper function to get the storage the elements currently live in
+static ctofu* fscl_vector_small_storage(cvector_small* vector) {
+    return vector->heap != NULL ? vector->heap : vector->inline_data;
+}
+
+// Helper function to get the storage of a read-only vector
+static const ctofu* fscl_vector_small_storage_const(const cvector_small* vector) {
+    return vector->heap != NULL ? vector->heap : vector->inline_data;
+}
+
+// Helper function to double the capacity, moving the inline elements to
+// the heap on the first growth
+static ctofu_error fscl_vector_small_grow(cvector_small* vector) {
+    if (vector->capacity > SIZE_MAX / 2 / sizeof(ctofu)) {
+        return fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+    }
+
+    size_t capacity = vector->capacity * 2;
+    if (vector->heap == NULL) {
+        ctofu* heap = (ctofu*)malloc(capacity * sizeof(ctofu));
+        if (heap == NULL) {
+            return fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+        }
+        memcpy(heap, vector->inline_data, vector->size * sizeof(ctofu));
+        vector->heap = heap;
+    } else {
+        ctofu* heap = (ctofu*)realloc(vector->heap, capacity * sizeof(ctofu));
+        if (heap == NULL) {
+            return fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+        }
+        vector->heap = heap;
+    }
+
+    vector->capacity = capacity;
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+// =======================
+// CREATE and DELETE
+// =======================
+
+cvector_small fscl_vector_small_create(ctofu_type expected_type) {
+    cvector_small new_vector;
+    new_vector.heap = NULL;
+    new_vector.size = 0;
+    new_vector.capacity = VECTOR_SMALL_INLINE;
+    new_vector.expected_type = expected_type;
+
+    return new_vector;
+}
+
+void fscl_vector_small_erase(cvector_small* vector) {
+    if (vector == NULL) {
+        return;
+    }
+
+    free(vector->heap);
+    vector->heap = NULL;
+    vector->size = 0;
+    vector->capacity = VECTOR_SMALL_INLINE;
+}
+
+// =======================
+// ALGORITHM FUNCTIONS
+// =======================
+
+ctofu_error fscl_vector_small_push_back(cvector_small* vector, ctofu element) {
+    if (vector == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    // Check if the type matches the expected type
+    if (element.type != vector->expected_type) {
+        return fscl_tofu_error(TOFU_WAS_MISMATCH);
+    }
+
+    if (vector->size == vector->capacity) {
+        ctofu_error result = fscl_vector_small_grow(vector);
+        if (result != TOFU_SUCCESS) {
+            return result;
+        }
+    }
+
+    fscl_vector_small_storage(vector)[vector->size++] = element;
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+int fscl_vector_small_search(const cvector_small* vector, ctofu target) {
+    if (vector == NULL) {
+        return -1;
+    }
+
+    // A read-only cvector view shares the search of cvector, SIMD included
+    cvector view = {
+        .data = (ctofu*)fscl_vector_small_storage_const(vector),
+        .size = vector->size,
+        .capacity = vector->capacity,
+        .expected_type = vector->expected_type,
+    };
+    return fscl_vector_search(&view, target);
+}
+
+void fscl_vector_small_reverse(cvector_small* vector) {
+    if (vector == NULL || vector->size < 2) {
+        return;
+    }
+
+    ctofu* data = fscl_vector_small_storage(vector);
+    for (size_t i = 0, j = vector->size - 1; i < j; ++i, --j) {
+        // Swap elements at positions i and j
+        ctofu temp = data[i];
+        data[i] = data[j];
+        data[j] = temp;
+    }
+}
+
+// =======================
+// UTILITY FUNCTIONS
+// =======================
+
+ctofu* fscl_vector_small_data(cvector_small* vector) {
+    return vector != NULL ? fscl_vector_small_storage(vector) : NULL;
+}
+
+bool fscl_vector_small_is_inline(const cvector_small* vector) {
+    return vector != NULL && vector->heap == NULL;
+}
+
+ctofu_error fscl_vector_small_setter(cvector_small* vector, size_t index, ctofu element) {
+    if (vector == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    if (index >= vector->size) {
+        return fscl_tofu_error(TOFU_WAS_BAD_RANGE);
+    }
+
+    // Check if the type matches the expected type
+    if (element.type != vector->expected_type) {
+        return fscl_tofu_error(TOFU_WAS_MISMATCH);
+    }
+
+    fscl_vector_small_storage(vector)[index] = element;
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+ctofu fscl_vector_small_getter(const cvector_small* vector, size_t index) {
+    if (vector == NULL || index >= vector->size) {
+        return (ctofu){.type = TOFU_INVALID_TYPE}; // Invalid or out-of-bounds access
+    }
+
+    return fscl_vector_small_storage_const(vector)[index];
+}
+
+size_t fscl_vector_small_size(const cvector_small* vector) {
+    return vector != NULL ? vector->size : 0;
+}
+
+bool fscl_vector_small_is_cnullptr(const cvector_small* vector) {
+    return vector == NULL;
+}
+
+bool fscl_vector_small_not_cnullptr(const cvector_small* vector) {
+    return vector != NULL;
+}
+
+bool fscl_vector_small_is_empty(const cvector_small* vector) {
+    return vector == NULL || vector->size == 0;
+}
+
+bool fscl_vector_small_not_empty(const cvector_small* vector) {
+    return vector != NULL && vector->size != 0;
+}
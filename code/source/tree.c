@@ -58,6 +58,58 @@ void fscl_tree_erase(ctree* tree) {
 // ALGORITHM FUNCTIONS
 // =======================
 
+// Helper function to get the height of a possibly empty subtree
+static int fscl_tree_height(const ctree_node* node) {
+    return node != NULL ? node->height : 0;
+}
+
+// Helper function to recompute the height of a node from its children
+static void fscl_tree_update_height(ctree_node* node) {
+    int left = fscl_tree_height(node->left);
+    int right = fscl_tree_height(node->right);
+    node->height = 1 + (left > right ? left : right);
+}
+
+// Helper function to rotate a subtree right, lifting its left child
+static ctree_node* fscl_tree_rotate_right(ctree_node* node) {
+    ctree_node* pivot = node->left;
+    node->left = pivot->right;
+    pivot->right = node;
+    fscl_tree_update_height(node);
+    fscl_tree_update_height(pivot);
+    return pivot;
+}
+
+// Helper function to rotate a subtree left, lifting its right child
+static ctree_node* fscl_tree_rotate_left(ctree_node* node) {
+    ctree_node* pivot = node->right;
+    node->right = pivot->left;
+    pivot->left = node;
+    fscl_tree_update_height(node);
+    fscl_tree_update_height(pivot);
+    return pivot;
+}
+
+// Helper function to restore the AVL balance of a subtree whose children
+// are balanced and differ in height by at most two
+static void fscl_tree_rebalance(ctree_node** root) {
+    ctree_node* node = *root;
+    fscl_tree_update_height(node);
+
+    int balance = fscl_tree_height(node->left) - fscl_tree_height(node->right);
+    if (balance > 1) {
+        if (fscl_tree_height(node->left->left) < fscl_tree_height(node->left->right)) {
+            node->left = fscl_tree_rotate_left(node->left);
+        }
+        *root = fscl_tree_rotate_right(node);
+    } else if (balance < -1) {
+        if (fscl_tree_height(node->right->right) < fscl_tree_height(node->right->left)) {
+            node->right = fscl_tree_rotate_right(node->right);
+        }
+        *root = fscl_tree_rotate_left(node);
+    }
+}
+
 // Helper function to find the minimum node in a subtree
 ctree_node* fscl_tree_find_min(ctree_node* node) {
     while (node->left != NULL) {
@@ -66,21 +118,18 @@ ctree_node* fscl_tree_find_min(ctree_node* node) {
     return node;
 }
 
-// Helper function to recursively remove a node
+// Helper function to recursively remove a node, rebalancing on the way back up
 ctofu_error fscl_tree_remove_recursive(ctree_node** root, ctofu data) {
     if (*root == NULL) {
         return fscl_tofu_error(TOFU_NOT_FOUND); // Element not found
     }
 
-    ctofu_error comparison_error = fscl_tofu_compare(&data, &(*root)->data);
-    if (comparison_error != TOFU_SUCCESS) {
-        return comparison_error;
-    }
-
-    if (comparison_error < 0) {
-        return fscl_tree_remove_recursive(&(*root)->left, data);
-    } else if (comparison_error > 0) {
-        return fscl_tree_remove_recursive(&(*root)->right, data);
+    ctofu_error result;
+    int compare_result = fscl_tofu_compare(&data, &(*root)->data);
+    if (compare_result < 0) {
+        result = fscl_tree_remove_recursive(&(*root)->left, data);
+    } else if (compare_result > 0) {
+        result = fscl_tree_remove_recursive(&(*root)->right, data);
     } else {
         // Node with the key found
 
@@ -89,22 +138,27 @@ ctofu_error fscl_tree_remove_recursive(ctree_node** root, ctofu data) {
             ctree_node* temp = *root;
             *root = (*root)->right;
             free(temp);
+            return fscl_tofu_error(TOFU_SUCCESS);
         } else if ((*root)->right == NULL) {
             ctree_node* temp = *root;
             *root = (*root)->left;
             free(temp);
-        } else {
-            // Case 3: Node with two children
-            ctree_node* temp = fscl_tree_find_min((*root)->right);
-            (*root)->data = temp->data;
-            return fscl_tree_remove_recursive(&(*root)->right, temp->data);
+            return fscl_tofu_error(TOFU_SUCCESS);
         }
 
-        return fscl_tofu_error(TOFU_SUCCESS);
+        // Case 2: Node with two children
+        ctree_node* temp = fscl_tree_find_min((*root)->right);
+        (*root)->data = temp->data;
+        result = fscl_tree_remove_recursive(&(*root)->right, temp->data);
+    }
+
+    if (result == TOFU_SUCCESS) {
+        fscl_tree_rebalance(root);
     }
+    return result;
 }
 
-// Helper function to recursively insert a node
+// Helper function to recursively insert a node, rebalancing on the way back up
 ctofu_error fscl_tree_insert_recursive(ctree_node** root, ctofu* data) {
     if (root == NULL || data == NULL) {
         return fscl_tofu_error(TOFU_WAS_NULLPTR);
@@ -119,22 +173,25 @@ ctofu_error fscl_tree_insert_recursive(ctree_node** root, ctofu* data) {
         (*root)->data = *data;
         (*root)->left = NULL;
         (*root)->right = NULL;
+        (*root)->height = 1;
 
         return fscl_tofu_error(TOFU_SUCCESS);
     }
 
-    ctofu_error comparison_error = fscl_tofu_compare(data, &(*root)->data);
-    if (comparison_error != TOFU_SUCCESS) {
-        return comparison_error;
-    }
-
-    if (comparison_error < 0) {
-        return fscl_tree_insert_recursive(&(*root)->left, data);
-    } else if (comparison_error > 0) {
-        return fscl_tree_insert_recursive(&(*root)->right, data);
+    ctofu_error result;
+    int compare_result = fscl_tofu_compare(data, &(*root)->data);
+    if (compare_result < 0) {
+        result = fscl_tree_insert_recursive(&(*root)->left, data);
+    } else if (compare_result > 0) {
+        result = fscl_tree_insert_recursive(&(*root)->right, data);
     } else {
         return fscl_tofu_error(TOFU_DUPLICATE_ELEMENT);  // Duplicate element
     }
+
+    if (result == TOFU_SUCCESS) {
+        fscl_tree_rebalance(root);
+    }
+    return result;
 }
 
 ctofu_error fscl_tree_insert(ctree* tree, ctofu data) {
@@ -142,6 +199,11 @@ ctofu_error fscl_tree_insert(ctree* tree, ctofu data) {
         return fscl_tofu_error(TOFU_WAS_NULLPTR);
     }
 
+    // Check if the type matches the type of the tree
+    if (data.type != tree->tree) {
+        return fscl_tofu_error(TOFU_WAS_MISMATCH);
+    }
+
     return fscl_tree_insert_recursive(&tree->root, &data);
 }
 
@@ -0,0 +1,56 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/xstructures/tvector.h"
+#include "xsimd.h"
+
+// Defines search and find_all of a numeric instance on top of the SIMD
+// kernel for its element type. u64 shares the i64 kernel, since integer
+// equality is bitwise.
+#define TVECTOR_DEFINE_SIMD_SEARCH(name, type, kernel, kernel_type)                        \
+    int fscl_vector_##name##_search(const cvector_##name* vector, type target) {           \
+        size_t index;                                                                      \
+        if (vector == NULL || kernel((const kernel_type*)vector->data, vector->size,       \
+                                     (kernel_type)target, &index, 1, 1) == 0) {            \
+            return -1;                                                                     \
+        }                                                                                  \
+        return (int)index;                                                                 \
+    }                                                                                      \
+                                                                                           \
+    size_t fscl_vector_##name##_find_all(const cvector_##name* vector, type target, size_t* indexes, size_t capacity) { \
+        if (vector == NULL || (indexes == NULL && capacity > 0)) {                         \
+            return 0;                                                                      \
+        }                                                                                  \
+        return kernel((const kernel_type*)vector->data, vector->size, (kernel_type)target, \
+                      indexes, capacity, SIZE_MAX);                                        \
+    }
+
+// =======================
+// INSTANCES
+// =======================
+
+FSCL_VECTOR_TYPED_DEFINE_BASE(i32, int32_t)
+TVECTOR_DEFINE_SIMD_SEARCH(i32, int32_t, fscl_simd_find_i32, int32_t)
+
+FSCL_VECTOR_TYPED_DEFINE_BASE(i64, int64_t)
+TVECTOR_DEFINE_SIMD_SEARCH(i64, int64_t, fscl_simd_find_i64, int64_t)
+
+FSCL_VECTOR_TYPED_DEFINE_BASE(u64, uint64_t)
+TVECTOR_DEFINE_SIMD_SEARCH(u64, uint64_t, fscl_simd_find_i64, int64_t)
+
+FSCL_VECTOR_TYPED_DEFINE_BASE(f32, float)
+TVECTOR_DEFINE_SIMD_SEARCH(f32, float, fscl_simd_find_f32, float)
+
+FSCL_VECTOR_TYPED_DEFINE_BASE(f64, double)
+TVECTOR_DEFINE_SIMD_SEARCH(f64, double, fscl_simd_find_f64, double)
+
+FSCL_VECTOR_TYPED_DEFINE(ptr, void*)
@@ -10,9 +10,717 @@ Description:
     feel free to contact Michael at michaelbrockus@gmail.com.
 ==============================================================================
 */
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L // Threads under strict ISO C
+#endif
 #include "fossil/xstructures/vector.h"
+#include "xsimd.h"
+#include "xthread.h"
+#include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+
+// Partitions this small are finished by insertion sort
+#define VECTOR_INSERTION_SORT_MAX 16
+
+// Integer vectors at least this long are radix sorted
+#define VECTOR_RADIX_MIN 256
+
+// Fewest elements worth giving a thread of a parallel sort, and the most
+// threads a parallel sort starts
+#define VECTOR_PARALLEL_MIN 16384
+#define VECTOR_PARALLEL_MAX 256
+
+// Fewest elements worth giving a thread of a parallel scan. Scans call back
+// per element, so they split sooner than sorts do.
+#define VECTOR_PARALLEL_GRAIN 4096
+
+// =======================
+// CAPACITY HELPERS
+// =======================
+
+// Helper function to set the capacity to exactly capacity elements,
+// leaving the vector unchanged when the allocation fails
+static ctofu_error fscl_vector_realloc(cvector* vector, size_t capacity) {
+    if (capacity > SIZE_MAX / sizeof(ctofu)) {
+        return fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+    }
+
+    if (capacity == 0) {
+        free(vector->data);
+        vector->data = NULL;
+        vector->capacity = 0;
+        return fscl_tofu_error(TOFU_SUCCESS);
+    }
+
+    ctofu* data = (ctofu*)realloc(vector->data, capacity * sizeof(ctofu));
+    if (data == NULL) {
+        return fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+    }
+
+    vector->data = data;
+    vector->capacity = capacity;
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+// Helper function to make room for needed elements, growing the capacity
+// by the growth policy of the vector so repeated growth stays amortized
+static ctofu_error fscl_vector_grow(cvector* vector, size_t needed) {
+    if (needed <= vector->capacity) {
+        return fscl_tofu_error(TOFU_SUCCESS);
+    }
+
+    size_t capacity = vector->capacity;
+    switch (vector->growth) {
+        case VECTOR_GROWTH_HALF:
+            capacity += capacity / 2;
+            break;
+        case VECTOR_GROWTH_STEP:
+            capacity += vector->growth_step > 0 ? vector->growth_step : 1;
+            break;
+        default:
+            capacity *= 2;
+            break;
+    }
+
+    // Also covers an empty vector and overflow of the growth above
+    if (capacity < needed) {
+        capacity = needed > INITIAL_CAPACITY ? needed : INITIAL_CAPACITY;
+    }
+
+    return fscl_vector_realloc(vector, capacity);
+}
+
+// =======================
+// RANGE HELPERS
+// =======================
+
+// Helper function to check whether elements point into the storage of vector
+static bool fscl_vector_owns(const cvector* vector, const ctofu* elements) {
+    uintptr_t start = (uintptr_t)vector->data;
+    uintptr_t address = (uintptr_t)elements;
+    return vector->data != NULL && address >= start && address < start + vector->capacity * sizeof(ctofu);
+}
+
+// Helper function to check that every element of a batch has the expected type
+static bool fscl_vector_types_match(const cvector* vector, const ctofu* elements, size_t n) {
+    bool match = true;
+    for (size_t i = 0; i < n; ++i) {
+        match &= elements[i].type == vector->expected_type;
+    }
+
+    return match;
+}
+
+// Helper function to insert n elements of the expected type before index
+// with a single capacity check and a single shift of the tail
+static ctofu_error fscl_vector_insert(cvector* vector, size_t index, const ctofu* elements, size_t n) {
+    if (n == 0) {
+        return fscl_tofu_error(TOFU_SUCCESS);
+    }
+
+    if (n > SIZE_MAX - vector->size) {
+        return fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+    }
+
+    // Elements taken from the vector itself would move under the realloc and
+    // the shift, so they are copied out first
+    ctofu* copy = NULL;
+    if (fscl_vector_owns(vector, elements)) {
+        copy = (ctofu*)malloc(n * sizeof(ctofu));
+        if (copy == NULL) {
+            return fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+        }
+        memcpy(copy, elements, n * sizeof(ctofu));
+        elements = copy;
+    }
+
+    ctofu_error result = fscl_vector_grow(vector, vector->size + n);
+    if (result == TOFU_SUCCESS) {
+        memmove(&vector->data[index + n], &vector->data[index], (vector->size - index) * sizeof(ctofu));
+        memcpy(&vector->data[index], elements, n * sizeof(ctofu));
+        vector->size += n;
+    }
+
+    free(copy);
+    return result;
+}
+
+// =======================
+// SEARCH HELPERS
+// =======================
+
+// Helper function to check whether elements of a type are equal exactly
+// when their 32-bit integer payloads are equal
+static bool fscl_vector_payload_is_i32(ctofu_type type) {
+    switch (type) {
+        case TOFU_INT_TYPE:
+            return sizeof(((ctofu*)NULL)->data.int_type) == sizeof(int32_t);
+        case TOFU_UINT_TYPE:
+            return sizeof(((ctofu*)NULL)->data.uint_type) == sizeof(int32_t);
+        default:
+            return false;
+    }
+}
+
+// Helper function to find the elements equal to target in order, storing
+// up to capacity of their indexes and stopping after limit matches.
+// Integer and floating-point payloads are compared in place by the SIMD
+// kernels; every other type goes through fscl_tofu_compare.
+static size_t fscl_vector_scan(const cvector* vector, const ctofu* target, size_t* indexes, size_t capacity, size_t limit) {
+    if (vector->size == 0) {
+        return 0;
+    }
+
+    // Elements always have the expected type, so only payloads can differ
+    if (target->type == vector->expected_type && fscl_vector_payload_is_i32(target->type)) {
+        int32_t payload;
+        memcpy(&payload, &target->data, sizeof(payload));
+        return fscl_simd_find_strided_i32((const unsigned char*)vector->data + offsetof(ctofu, data), sizeof(ctofu),
+                                          vector->size, payload, indexes, capacity, limit);
+    }
+
+    // Floating-point payloads compare with ==, so NaN matches nothing
+    if (target->type == vector->expected_type && target->type == TOFU_FLOAT_TYPE) {
+        return fscl_simd_find_strided_f32((const unsigned char*)vector->data + offsetof(ctofu, data.float_type), sizeof(ctofu),
+                                          vector->size, target->data.float_type, indexes, capacity, limit);
+    }
+    if (target->type == vector->expected_type && target->type == TOFU_DOUBLE_TYPE) {
+        return fscl_simd_find_strided_f64((const unsigned char*)vector->data + offsetof(ctofu, data.double_type), sizeof(ctofu),
+                                          vector->size, target->data.double_type, indexes, capacity, limit);
+    }
+
+    size_t count = 0;
+    for (size_t i = 0; i < vector->size && count < limit; ++i) {
+        if (fscl_tofu_compare(target, &vector->data[i]) == TOFU_SUCCESS) {
+            if (count < capacity) {
+                indexes[count] = i;
+            }
+            count++;
+        }
+    }
+
+    return count;
+}
+
+// =======================
+// SORT HELPERS
+// =======================
+
+static bool fscl_vector_less(const ctofu* a, const ctofu* b) {
+    return fscl_tofu_compare(a, b) < 0;
+}
+
+static void fscl_vector_swap(ctofu* a, ctofu* b) {
+    ctofu temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+static void fscl_vector_insertion_sort(ctofu* data, size_t n) {
+    for (size_t i = 1; i < n; ++i) {
+        ctofu item = data[i];
+        size_t j = i;
+        while (j > 0 && fscl_vector_less(&item, &data[j - 1])) {
+            data[j] = data[j - 1];
+            j--;
+        }
+        data[j] = item;
+    }
+}
+
+static void fscl_vector_sift_down(ctofu* data, size_t root, size_t n) {
+    for (;;) {
+        size_t child = 2 * root + 1;
+        if (child >= n) {
+            return;
+        }
+        if (child + 1 < n && fscl_vector_less(&data[child], &data[child + 1])) {
+            child++;
+        }
+        if (!fscl_vector_less(&data[root], &data[child])) {
+            return;
+        }
+        fscl_vector_swap(&data[root], &data[child]);
+        root = child;
+    }
+}
+
+static void fscl_vector_heap_sort(ctofu* data, size_t n) {
+    for (size_t i = n / 2; i-- > 0;) {
+        fscl_vector_sift_down(data, i, n);
+    }
+    for (size_t end = n; end-- > 1;) {
+        fscl_vector_swap(&data[0], &data[end]);
+        fscl_vector_sift_down(data, 0, end);
+    }
+}
+
+// Helper function to split data around the median of its first, middle and
+// last elements. Returns the last index of the lower part; both parts are
+// non-empty. The scans are bounded so an inconsistent compare cannot run
+// them off the ends.
+static size_t fscl_vector_partition(ctofu* data, size_t n) {
+    size_t mid = (n - 1) / 2;
+    if (fscl_vector_less(&data[mid], &data[0])) {
+        fscl_vector_swap(&data[mid], &data[0]);
+    }
+    if (fscl_vector_less(&data[n - 1], &data[mid])) {
+        fscl_vector_swap(&data[n - 1], &data[mid]);
+        if (fscl_vector_less(&data[mid], &data[0])) {
+            fscl_vector_swap(&data[mid], &data[0]);
+        }
+    }
+
+    const ctofu pivot = data[mid];
+    size_t i = 0;
+    size_t j = n - 1;
+    for (;;) {
+        while (i < n - 1 && fscl_vector_less(&data[i], &pivot)) {
+            i++;
+        }
+        while (j > 0 && fscl_vector_less(&pivot, &data[j])) {
+            j--;
+        }
+        if (i >= j) {
+            return j < n - 1 ? j : n - 2;
+        }
+        fscl_vector_swap(&data[i], &data[j]);
+        i++;
+        j--;
+    }
+}
+
+// Helper function to quicksort with a recursion budget, switching to heap
+// sort once it runs out so adversarial inputs stay O(n log n)
+static void fscl_vector_introsort(ctofu* data, size_t n, unsigned depth) {
+    while (n > VECTOR_INSERTION_SORT_MAX) {
+        if (depth == 0) {
+            fscl_vector_heap_sort(data, n);
+            return;
+        }
+        depth--;
+
+        // Recurse into the smaller part and loop on the larger one
+        size_t split = fscl_vector_partition(data, n) + 1;
+        if (split < n - split) {
+            fscl_vector_introsort(data, split, depth);
+            data += split;
+            n -= split;
+        } else {
+            fscl_vector_introsort(data + split, n - split, depth);
+            n = split;
+        }
+    }
+
+    fscl_vector_insertion_sort(data, n);
+}
+
+// Helper function to introsort n elements with a depth budget of 2 log2 n
+static void fscl_vector_sort_range(ctofu* data, size_t n) {
+    unsigned depth = 0;
+    for (size_t count = n; count > 1; count >>= 1) {
+        depth += 2;
+    }
+
+    fscl_vector_introsort(data, n, depth);
+}
+
+// Helper function to radix sort a vector of 32-bit integer payloads, one
+// byte per pass over the extracted keys. Returns false when the scratch
+// keys cannot be allocated.
+static bool fscl_vector_radix_sort(cvector* vector) {
+    const size_t n = vector->size;
+    uint32_t* keys = (uint32_t*)malloc(2 * n * sizeof(uint32_t));
+    if (keys == NULL) {
+        return false;
+    }
+    uint32_t* scratch = keys + n;
+
+    // Flipping the sign bit orders signed payloads as unsigned keys
+    const uint32_t flip = vector->expected_type == TOFU_INT_TYPE ? 0x80000000u : 0u;
+    size_t counts[4][256] = { { 0 } };
+    for (size_t i = 0; i < n; ++i) {
+        uint32_t payload;
+        memcpy(&payload, &vector->data[i].data, sizeof(payload));
+        keys[i] = payload ^ flip;
+        for (unsigned pass = 0; pass < 4; ++pass) {
+            counts[pass][(keys[i] >> (8 * pass)) & 0xFF]++;
+        }
+    }
+
+    uint32_t* from = keys;
+    uint32_t* to = scratch;
+    for (unsigned pass = 0; pass < 4; ++pass) {
+        const unsigned shift = 8 * pass;
+        if (counts[pass][(from[0] >> shift) & 0xFF] == n) {
+            continue; // Every key has the same byte here
+        }
+
+        size_t offset = 0;
+        for (unsigned digit = 0; digit < 256; ++digit) {
+            size_t count = counts[pass][digit];
+            counts[pass][digit] = offset;
+            offset += count;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            to[counts[pass][(from[i] >> shift) & 0xFF]++] = from[i];
+        }
+
+        uint32_t* temp = from;
+        from = to;
+        to = temp;
+    }
+
+    // Equal payloads are equal elements, so writing the keys back is the sort
+    for (size_t i = 0; i < n; ++i) {
+        uint32_t payload = from[i] ^ flip;
+        memcpy(&vector->data[i].data, &payload, sizeof(payload));
+    }
+
+    free(keys);
+    return true;
+}
+
+// =======================
+// PARALLEL SORT HELPERS
+// =======================
+
+// Helper function to pick how many threads work on n elements, giving each
+// at least min of them
+static size_t fscl_vector_parallel_threads(size_t n, size_t nthreads, size_t min) {
+    size_t threads = nthreads > 0 ? nthreads : fscl_parallel_cpu_count();
+    if (threads > n / min) {
+        threads = n / min;
+    }
+    if (threads > VECTOR_PARALLEL_MAX) {
+        threads = VECTOR_PARALLEL_MAX;
+    }
+
+    return threads > 0 ? threads : 1;
+}
+
+// Helper function to get where part index of n elements split into parts
+// nearly equal parts starts
+static size_t fscl_vector_chunk(size_t n, size_t parts, size_t index) {
+    return n / parts * index + (index < n % parts ? index : n % parts);
+}
+
+// Shared state of a parallel merge sort. Each round merges pairs of
+// adjacent runs of from into to, split evenly across the threads by
+// output position.
+struct cvector_merge_sort {
+    ctofu* from;
+    ctofu* to;
+    size_t* bounds;      // Run r covers [bounds[r], bounds[r + 1])
+    size_t runs;
+    size_t size;
+    size_t threads;
+};
+
+static void fscl_vector_sort_run_task(void* context, size_t index) {
+    struct cvector_merge_sort* sort = (struct cvector_merge_sort*)context;
+    size_t start = sort->bounds[index];
+    fscl_vector_sort_range(sort->from + start, sort->bounds[index + 1] - start);
+}
+
+// Helper function to count how many of the first k elements of the stable
+// merge of a and b come from a
+static size_t fscl_vector_corank(size_t k, const ctofu* a, size_t na, const ctofu* b, size_t nb) {
+    size_t low = k > nb ? k - nb : 0;
+    size_t high = k < na ? k : na;
+    while (low < high) {
+        size_t i = low + (high - low) / 2;
+        size_t j = k - i;
+        if (i == na || j == 0 || fscl_vector_less(&b[j - 1], &a[i])) {
+            high = i;
+        } else {
+            low = i + 1;
+        }
+    }
+
+    return low;
+}
+
+// Helper function to merge two sorted runs, taking from a first on ties
+static void fscl_vector_merge(const ctofu* a, size_t na, const ctofu* b, size_t nb, ctofu* out) {
+    size_t i = 0;
+    size_t j = 0;
+    while (i < na && j < nb) {
+        if (fscl_vector_less(&b[j], &a[i])) {
+            *out++ = b[j++];
+        } else {
+            *out++ = a[i++];
+        }
+    }
+
+    memcpy(out, a + i, (na - i) * sizeof(ctofu));
+    memcpy(out + (na - i), b + j, (nb - j) * sizeof(ctofu));
+}
+
+static void fscl_vector_merge_task(void* context, size_t index) {
+    struct cvector_merge_sort* sort = (struct cvector_merge_sort*)context;
+    const size_t low = fscl_vector_chunk(sort->size, sort->threads, index);
+    const size_t high = fscl_vector_chunk(sort->size, sort->threads, index + 1);
+
+    for (size_t r = 0; r < sort->runs; r += 2) {
+        size_t start = sort->bounds[r];
+        size_t middle = sort->bounds[r + 1 < sort->runs ? r + 1 : sort->runs];
+        size_t end = sort->bounds[r + 2 < sort->runs ? r + 2 : sort->runs];
+        if (end <= low) {
+            continue;
+        }
+        if (start >= high) {
+            break;
+        }
+
+        // The slice of this merge's output that falls in [low, high)
+        const ctofu* a = sort->from + start;
+        const ctofu* b = sort->from + middle;
+        size_t first = (low > start ? low : start) - start;
+        size_t last = (high < end ? high : end) - start;
+        size_t i0 = fscl_vector_corank(first, a, middle - start, b, end - middle);
+        size_t i1 = fscl_vector_corank(last, a, middle - start, b, end - middle);
+        fscl_vector_merge(a + i0, i1 - i0, b + (first - i0), (last - i1) - (first - i0), sort->to + start + first);
+    }
+}
+
+// Helper function to sort runs of the vector on every thread, then merge
+// them pairwise, each round using every thread. Returns false when the
+// scratch buffer cannot be allocated.
+static bool fscl_vector_merge_sort_parallel(cvector* vector, size_t threads) {
+    ctofu* scratch = (ctofu*)malloc(vector->size * sizeof(ctofu));
+    size_t* bounds = (size_t*)malloc((threads + 1) * sizeof(size_t));
+    if (scratch == NULL || bounds == NULL) {
+        free(scratch);
+        free(bounds);
+        return false;
+    }
+
+    struct cvector_merge_sort sort = { vector->data, scratch, bounds, threads, vector->size, threads };
+    for (size_t r = 0; r <= threads; ++r) {
+        bounds[r] = fscl_vector_chunk(vector->size, threads, r);
+    }
+    fscl_parallel_run(threads, fscl_vector_sort_run_task, &sort);
+
+    while (sort.runs > 1) {
+        fscl_parallel_run(threads, fscl_vector_merge_task, &sort);
+
+        size_t runs = (sort.runs + 1) / 2;
+        for (size_t r = 0; r <= runs; ++r) {
+            bounds[r] = bounds[2 * r < sort.runs ? 2 * r : sort.runs];
+        }
+        sort.runs = runs;
+
+        ctofu* temp = sort.from;
+        sort.from = sort.to;
+        sort.to = temp;
+    }
+
+    if (sort.from != vector->data) {
+        memcpy(vector->data, sort.from, vector->size * sizeof(ctofu));
+    }
+
+    free(scratch);
+    free(bounds);
+    return true;
+}
+
+// Shared state of a parallel LSD radix sort over extracted 32-bit keys.
+// Each thread owns one chunk of the keys and counts the digits of its
+// chunk, so the scatter of every chunk lands in its own disjoint slots.
+struct cvector_radix_sort {
+    cvector* vector;
+    uint32_t* from;
+    uint32_t* to;
+    size_t (*counts)[256];  // Digit counts per thread, then scatter offsets
+    size_t threads;
+    uint32_t flip;          // Sign bit flip ordering signed payloads as unsigned
+    unsigned shift;         // Bit position of the digit of the current pass
+};
+
+static void fscl_vector_radix_extract_task(void* context, size_t index) {
+    struct cvector_radix_sort* sort = (struct cvector_radix_sort*)context;
+    const size_t n = sort->vector->size;
+    for (size_t i = fscl_vector_chunk(n, sort->threads, index); i < fscl_vector_chunk(n, sort->threads, index + 1); ++i) {
+        uint32_t payload;
+        memcpy(&payload, &sort->vector->data[i].data, sizeof(payload));
+        sort->from[i] = payload ^ sort->flip;
+    }
+}
+
+static void fscl_vector_radix_count_task(void* context, size_t index) {
+    struct cvector_radix_sort* sort = (struct cvector_radix_sort*)context;
+    const size_t n = sort->vector->size;
+    size_t* counts = sort->counts[index];
+    memset(counts, 0, 256 * sizeof(size_t));
+    for (size_t i = fscl_vector_chunk(n, sort->threads, index); i < fscl_vector_chunk(n, sort->threads, index + 1); ++i) {
+        counts[(sort->from[i] >> sort->shift) & 0xFF]++;
+    }
+}
+
+static void fscl_vector_radix_scatter_task(void* context, size_t index) {
+    struct cvector_radix_sort* sort = (struct cvector_radix_sort*)context;
+    const size_t n = sort->vector->size;
+    size_t* offsets = sort->counts[index];
+    for (size_t i = fscl_vector_chunk(n, sort->threads, index); i < fscl_vector_chunk(n, sort->threads, index + 1); ++i) {
+        uint32_t key = sort->from[i];
+        sort->to[offsets[(key >> sort->shift) & 0xFF]++] = key;
+    }
+}
+
+static void fscl_vector_radix_store_task(void* context, size_t index) {
+    struct cvector_radix_sort* sort = (struct cvector_radix_sort*)context;
+    const size_t n = sort->vector->size;
+    for (size_t i = fscl_vector_chunk(n, sort->threads, index); i < fscl_vector_chunk(n, sort->threads, index + 1); ++i) {
+        uint32_t payload = sort->from[i] ^ sort->flip;
+        memcpy(&sort->vector->data[i].data, &payload, sizeof(payload));
+    }
+}
+
+// Helper function to radix sort a vector of 32-bit integer payloads on
+// several threads, a byte per pass. Returns false when the scratch keys
+// cannot be allocated.
+static bool fscl_vector_radix_sort_parallel(cvector* vector, size_t threads) {
+    const size_t n = vector->size;
+    uint32_t* keys = (uint32_t*)malloc(2 * n * sizeof(uint32_t));
+    size_t (*counts)[256] = (size_t (*)[256])malloc(threads * sizeof(*counts));
+    if (keys == NULL || counts == NULL) {
+        free(keys);
+        free(counts);
+        return false;
+    }
+
+    struct cvector_radix_sort sort = {
+        vector, keys, keys + n, counts, threads,
+        vector->expected_type == TOFU_INT_TYPE ? 0x80000000u : 0u, 0
+    };
+    fscl_parallel_run(threads, fscl_vector_radix_extract_task, &sort);
+
+    for (unsigned pass = 0; pass < 4; ++pass) {
+        sort.shift = 8 * pass;
+        fscl_parallel_run(threads, fscl_vector_radix_count_task, &sort);
+
+        // Turn the counts into offsets: digits in order, threads in order
+        size_t offset = 0;
+        bool uniform = false;
+        for (unsigned digit = 0; digit < 256; ++digit) {
+            size_t total = 0;
+            for (size_t t = 0; t < threads; ++t) {
+                size_t count = counts[t][digit];
+                counts[t][digit] = offset;
+                offset += count;
+                total += count;
+            }
+            uniform |= total == n;
+        }
+        if (uniform) {
+            continue; // Every key has the same byte here
+        }
+
+        fscl_parallel_run(threads, fscl_vector_radix_scatter_task, &sort);
+
+        uint32_t* temp = sort.from;
+        sort.from = sort.to;
+        sort.to = temp;
+    }
+
+    fscl_parallel_run(threads, fscl_vector_radix_store_task, &sort);
+
+    free(keys);
+    free(counts);
+    return true;
+}
+
+// =======================
+// PARALLEL SCAN HELPERS
+// =======================
+
+// Results of one thread of a scan, padded so that the slots of two
+// threads never share a cache line
+struct cvector_scan_slot {
+    ctofu accumulator;
+    size_t count;           // Elements the chunk keeps, then where they go
+    bool mismatch;
+    unsigned char pad[FSCL_CACHE_LINE];
+};
+
+// Shared state of a parallel scan. Each thread owns the chunk of its index
+// and writes only its own slot and its own part of keep.
+struct cvector_scan {
+    cvector* vector;
+    size_t threads;
+    void* context;
+    struct cvector_scan_slot* slots;
+    cvector_for_each_fn for_each;
+    cvector_reduce_fn reduce;
+    cvector_predicate_fn predicate;
+    cvector_transform_fn transform;
+    unsigned char* keep;    // Predicate result per element
+    cvector* out;
+    size_t base;            // Size of out before the kept elements
+};
+
+static void fscl_vector_for_each_task(void* context, size_t index) {
+    struct cvector_scan* scan = (struct cvector_scan*)context;
+    const size_t n = scan->vector->size;
+    const ctofu* data = scan->vector->data;
+    for (size_t i = fscl_vector_chunk(n, scan->threads, index); i < fscl_vector_chunk(n, scan->threads, index + 1); ++i) {
+        scan->for_each(&data[i], scan->context);
+    }
+}
+
+static void fscl_vector_reduce_task(void* context, size_t index) {
+    struct cvector_scan* scan = (struct cvector_scan*)context;
+    const size_t n = scan->vector->size;
+    const ctofu* data = scan->vector->data;
+    ctofu* accumulator = &scan->slots[index].accumulator;
+    for (size_t i = fscl_vector_chunk(n, scan->threads, index); i < fscl_vector_chunk(n, scan->threads, index + 1); ++i) {
+        scan->reduce(accumulator, &data[i], scan->context);
+    }
+}
+
+static void fscl_vector_filter_count_task(void* context, size_t index) {
+    struct cvector_scan* scan = (struct cvector_scan*)context;
+    const size_t n = scan->vector->size;
+    const ctofu* data = scan->vector->data;
+    size_t count = 0;
+    for (size_t i = fscl_vector_chunk(n, scan->threads, index); i < fscl_vector_chunk(n, scan->threads, index + 1); ++i) {
+        scan->keep[i] = scan->predicate(&data[i], scan->context);
+        count += scan->keep[i];
+    }
+    scan->slots[index].count = count;
+}
+
+static void fscl_vector_filter_copy_task(void* context, size_t index) {
+    struct cvector_scan* scan = (struct cvector_scan*)context;
+    const size_t n = scan->vector->size;
+    const ctofu* data = scan->vector->data;
+    ctofu* to = scan->out->data + scan->base + scan->slots[index].count;
+    for (size_t i = fscl_vector_chunk(n, scan->threads, index); i < fscl_vector_chunk(n, scan->threads, index + 1); ++i) {
+        if (scan->keep[i]) {
+            *to++ = data[i];
+        }
+    }
+}
+
+static void fscl_vector_transform_task(void* context, size_t index) {
+    struct cvector_scan* scan = (struct cvector_scan*)context;
+    const size_t n = scan->vector->size;
+    ctofu* data = scan->vector->data;
+    bool mismatch = false;
+    for (size_t i = fscl_vector_chunk(n, scan->threads, index); i < fscl_vector_chunk(n, scan->threads, index + 1); ++i) {
+        ctofu result = scan->transform(&data[i], scan->context);
+        if (result.type == scan->vector->expected_type) {
+            data[i] = result;
+        } else {
+            mismatch = true;
+        }
+    }
+    scan->slots[index].mismatch = mismatch;
+}
 
 // =======================
 // CREATE and DELETE
@@ -29,6 +737,8 @@ cvector fscl_vector_create(ctofu_type expected_type) {
     new_vector.size = 0;
     new_vector.capacity = INITIAL_CAPACITY;
     new_vector.expected_type = expected_type;
+    new_vector.growth = VECTOR_GROWTH_DOUBLE;
+    new_vector.growth_step = 0;
 
     return new_vector;
 }
@@ -44,6 +754,77 @@ void fscl_vector_erase(cvector* vector) {
     vector->capacity = 0;
 }
 
+// =======================
+// CAPACITY FUNCTIONS
+// =======================
+
+ctofu_error fscl_vector_reserve(cvector* vector, size_t capacity) {
+    if (vector == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    if (capacity <= vector->capacity) {
+        return fscl_tofu_error(TOFU_SUCCESS);
+    }
+
+    return fscl_vector_realloc(vector, capacity);
+}
+
+ctofu_error fscl_vector_shrink_to_fit(cvector* vector) {
+    if (vector == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    if (vector->capacity == vector->size) {
+        return fscl_tofu_error(TOFU_SUCCESS);
+    }
+
+    return fscl_vector_realloc(vector, vector->size);
+}
+
+ctofu_error fscl_vector_resize(cvector* vector, size_t size, ctofu fill) {
+    if (vector == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    if (size > vector->size) {
+        if (fill.type != vector->expected_type) {
+            return fscl_tofu_error(TOFU_WAS_MISMATCH);
+        }
+
+        // Sized exactly, since the caller named the size it needs
+        ctofu_error result = fscl_vector_reserve(vector, size);
+        if (result != TOFU_SUCCESS) {
+            return result;
+        }
+
+        for (size_t i = vector->size; i < size; ++i) {
+            vector->data[i] = fill;
+        }
+    }
+
+    vector->size = size;
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+ctofu_error fscl_vector_set_growth(cvector* vector, cvector_growth growth, size_t step) {
+    if (vector == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    if (growth == VECTOR_GROWTH_STEP && step == 0) {
+        return fscl_tofu_error(TOFU_WAS_BAD_RANGE);
+    }
+
+    vector->growth = growth;
+    vector->growth_step = growth == VECTOR_GROWTH_STEP ? step : 0;
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+size_t fscl_vector_capacity(const cvector* vector) {
+    return vector != NULL ? vector->capacity : 0;
+}
+
 // =======================
 // ALGORITHM FUNCTIONS
 // =======================
@@ -54,13 +835,9 @@ void fscl_vector_push_back(cvector* vector, ctofu element) {
     }
 
     // Check if the vector needs to be resized
-    if (vector->size == vector->capacity) {
-        vector->capacity *= 2;
-        vector->data = (ctofu*)realloc(vector->data, vector->capacity * sizeof(ctofu));
-        if (vector->data == NULL) {
-            // Handle memory allocation failure
-            exit(EXIT_FAILURE);
-        }
+    if (fscl_vector_grow(vector, vector->size + 1) != TOFU_SUCCESS) {
+        // Handle memory allocation failure
+        exit(EXIT_FAILURE);
     }
 
     // Check if the type matches the expected type
@@ -73,18 +850,79 @@ void fscl_vector_push_back(cvector* vector, ctofu element) {
     vector->data[vector->size++] = element;
 }
 
+ctofu_error fscl_vector_append(cvector* vector, const ctofu* elements, size_t n) {
+    if (vector == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    return fscl_vector_insert_range(vector, vector->size, elements, n);
+}
+
+ctofu_error fscl_vector_insert_range(cvector* vector, size_t index, const ctofu* elements, size_t n) {
+    if (vector == NULL || (elements == NULL && n > 0)) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    if (index > vector->size) {
+        return fscl_tofu_error(TOFU_WAS_BAD_RANGE);
+    }
+
+    if (!fscl_vector_types_match(vector, elements, n)) {
+        return fscl_tofu_error(TOFU_WAS_MISMATCH);
+    }
+
+    return fscl_vector_insert(vector, index, elements, n);
+}
+
+ctofu_error fscl_vector_erase_range(cvector* vector, size_t index, size_t n) {
+    if (vector == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    if (index > vector->size || n > vector->size - index) {
+        return fscl_tofu_error(TOFU_WAS_BAD_RANGE);
+    }
+
+    if (n > 0) {
+        memmove(&vector->data[index], &vector->data[index + n], (vector->size - index - n) * sizeof(ctofu));
+        vector->size -= n;
+    }
+
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+ctofu_error fscl_vector_extend(cvector* vector, const cvector* other) {
+    if (vector == NULL || other == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    if (other->expected_type != vector->expected_type) {
+        return fscl_tofu_error(TOFU_WAS_MISMATCH);
+    }
+
+    // Both vectors only hold elements of their expected type
+    return fscl_vector_insert(vector, vector->size, other->data, other->size);
+}
+
 int fscl_vector_search(const cvector* vector, ctofu target) {
     if (vector == NULL) {
         return -1;
     }
 
-    for (size_t i = 0; i < vector->size; ++i) {
-        if (fscl_tofu_compare(&target, &vector->data[i]) == TOFU_SUCCESS) {
-            return i; // Element found at index i
-        }
+    size_t index;
+    if (fscl_vector_scan(vector, &target, &index, 1, 1) == 0) {
+        return -1; // Element not found
+    }
+
+    return (int)index; // Element found at index
+}
+
+size_t fscl_vector_find_all(const cvector* vector, ctofu target, size_t* indexes, size_t capacity) {
+    if (vector == NULL || (indexes == NULL && capacity > 0)) {
+        return 0;
     }
 
-    return -1; // Element not found
+    return fscl_vector_scan(vector, &target, indexes, capacity, SIZE_MAX);
 }
 
 void fscl_vector_reverse(cvector* vector) {
@@ -100,6 +938,241 @@ void fscl_vector_reverse(cvector* vector) {
     }
 }
 
+// =======================
+// SORT FUNCTIONS
+// =======================
+
+ctofu_error fscl_vector_sort(cvector* vector) {
+    if (vector == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    if (vector->size < 2) {
+        return fscl_tofu_error(TOFU_SUCCESS);
+    }
+
+    if (vector->size >= VECTOR_RADIX_MIN && fscl_vector_payload_is_i32(vector->expected_type) && fscl_vector_radix_sort(vector)) {
+        return fscl_tofu_error(TOFU_SUCCESS);
+    }
+
+    fscl_vector_sort_range(vector->data, vector->size);
+
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+ctofu_error fscl_vector_sort_parallel(cvector* vector, size_t nthreads) {
+    if (vector == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    size_t threads = fscl_vector_parallel_threads(vector->size, nthreads, VECTOR_PARALLEL_MIN);
+
+    // Small inputs and failed scratch allocations use the sequential sort
+    bool sorted = false;
+    if (threads >= 2) {
+        sorted = fscl_vector_payload_is_i32(vector->expected_type)
+            ? fscl_vector_radix_sort_parallel(vector, threads)
+            : fscl_vector_merge_sort_parallel(vector, threads);
+    }
+
+    return sorted ? fscl_tofu_error(TOFU_SUCCESS) : fscl_vector_sort(vector);
+}
+
+bool fscl_vector_is_sorted(const cvector* vector) {
+    if (vector == NULL) {
+        return true;
+    }
+
+    for (size_t i = 1; i < vector->size; ++i) {
+        if (fscl_vector_less(&vector->data[i], &vector->data[i - 1])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+size_t fscl_vector_lower_bound(const cvector* vector, ctofu target) {
+    if (vector == NULL) {
+        return 0;
+    }
+
+    if (target.type != vector->expected_type) {
+        return vector->size;
+    }
+
+    size_t first = 0;
+    for (size_t n = vector->size; n > 0;) {
+        size_t half = n / 2;
+        if (fscl_vector_less(&vector->data[first + half], &target)) {
+            first += half + 1;
+            n -= half + 1;
+        } else {
+            n = half;
+        }
+    }
+
+    return first;
+}
+
+size_t fscl_vector_upper_bound(const cvector* vector, ctofu target) {
+    if (vector == NULL) {
+        return 0;
+    }
+
+    if (target.type != vector->expected_type) {
+        return vector->size;
+    }
+
+    size_t first = 0;
+    for (size_t n = vector->size; n > 0;) {
+        size_t half = n / 2;
+        if (!fscl_vector_less(&target, &vector->data[first + half])) {
+            first += half + 1;
+            n -= half + 1;
+        } else {
+            n = half;
+        }
+    }
+
+    return first;
+}
+
+int fscl_vector_binary_search(const cvector* vector, ctofu target) {
+    size_t index = fscl_vector_lower_bound(vector, target);
+    if (vector == NULL || index >= vector->size || fscl_tofu_compare(&vector->data[index], &target) != TOFU_SUCCESS) {
+        return -1; // Element not found
+    }
+
+    return (int)index;
+}
+
+// =======================
+// PARALLEL FUNCTIONS
+// =======================
+
+ctofu_error fscl_vector_for_each_parallel(const cvector* vector, cvector_for_each_fn fn, void* context, size_t nthreads) {
+    if (vector == NULL || fn == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    struct cvector_scan scan = { 0 };
+    scan.vector = (cvector*)vector;
+    scan.threads = fscl_vector_parallel_threads(vector->size, nthreads, VECTOR_PARALLEL_GRAIN);
+    scan.context = context;
+    scan.for_each = fn;
+    fscl_parallel_run(scan.threads, fscl_vector_for_each_task, &scan);
+
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+ctofu_error fscl_vector_reduce_parallel(const cvector* vector, cvector_reduce_fn fn, ctofu identity, void* context, ctofu* result, size_t nthreads) {
+    if (vector == NULL || fn == NULL || result == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    struct cvector_scan scan = { 0 };
+    scan.vector = (cvector*)vector;
+    scan.threads = fscl_vector_parallel_threads(vector->size, nthreads, VECTOR_PARALLEL_GRAIN);
+    scan.context = context;
+    scan.reduce = fn;
+    scan.slots = (struct cvector_scan_slot*)malloc(scan.threads * sizeof(struct cvector_scan_slot));
+    if (scan.slots == NULL) {
+        return fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+    }
+
+    for (size_t t = 0; t < scan.threads; ++t) {
+        scan.slots[t].accumulator = identity;
+    }
+    fscl_parallel_run(scan.threads, fscl_vector_reduce_task, &scan);
+
+    // Fold the partial results in chunk order
+    *result = identity;
+    for (size_t t = 0; t < scan.threads; ++t) {
+        fn(result, &scan.slots[t].accumulator, context);
+    }
+
+    free(scan.slots);
+    return fscl_tofu_error(TOFU_SUCCESS);
+}
+
+ctofu_error fscl_vector_filter(const cvector* vector, cvector_predicate_fn predicate, void* context, cvector* out, size_t nthreads) {
+    if (vector == NULL || predicate == NULL || out == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    if (out->expected_type != vector->expected_type) {
+        return fscl_tofu_error(TOFU_WAS_MISMATCH);
+    }
+
+    if (vector->size == 0) {
+        return fscl_tofu_error(TOFU_SUCCESS);
+    }
+
+    struct cvector_scan scan = { 0 };
+    scan.vector = (cvector*)vector;
+    scan.threads = fscl_vector_parallel_threads(vector->size, nthreads, VECTOR_PARALLEL_GRAIN);
+    scan.context = context;
+    scan.predicate = predicate;
+    scan.slots = (struct cvector_scan_slot*)malloc(scan.threads * sizeof(struct cvector_scan_slot));
+    scan.keep = (unsigned char*)malloc(vector->size);
+    if (scan.slots == NULL || scan.keep == NULL) {
+        free(scan.slots);
+        free(scan.keep);
+        return fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+    }
+
+    fscl_parallel_run(scan.threads, fscl_vector_filter_count_task, &scan);
+
+    // Turn the counts into offsets so every chunk copies to its own slots
+    size_t kept = 0;
+    for (size_t t = 0; t < scan.threads; ++t) {
+        size_t count = scan.slots[t].count;
+        scan.slots[t].count = kept;
+        kept += count;
+    }
+
+    // Growing out may move the elements when out is the vector itself, so
+    // the copy reads them through the vector only afterwards
+    ctofu_error result = fscl_vector_grow(out, out->size + kept);
+    if (result == TOFU_SUCCESS) {
+        scan.out = out;
+        scan.base = out->size;
+        fscl_parallel_run(scan.threads, fscl_vector_filter_copy_task, &scan);
+        out->size += kept;
+    }
+
+    free(scan.slots);
+    free(scan.keep);
+    return result;
+}
+
+ctofu_error fscl_vector_transform(cvector* vector, cvector_transform_fn fn, void* context, size_t nthreads) {
+    if (vector == NULL || fn == NULL) {
+        return fscl_tofu_error(TOFU_WAS_NULLPTR);
+    }
+
+    struct cvector_scan scan = { 0 };
+    scan.vector = vector;
+    scan.threads = fscl_vector_parallel_threads(vector->size, nthreads, VECTOR_PARALLEL_GRAIN);
+    scan.context = context;
+    scan.transform = fn;
+    scan.slots = (struct cvector_scan_slot*)malloc(scan.threads * sizeof(struct cvector_scan_slot));
+    if (scan.slots == NULL) {
+        return fscl_tofu_error(TOFU_WAS_BAD_MALLOC);
+    }
+
+    fscl_parallel_run(scan.threads, fscl_vector_transform_task, &scan);
+
+    bool mismatch = false;
+    for (size_t t = 0; t < scan.threads; ++t) {
+        mismatch |= scan.slots[t].mismatch;
+    }
+
+    free(scan.slots);
+    return fscl_tofu_error(mismatch ? TOFU_WAS_MISMATCH : TOFU_SUCCESS);
+}
+
 // =======================
 // UTILITY FUNCTIONS
 // =======================
@@ -0,0 +1,52 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef fscl_xsimd_H
+#define fscl_xsimd_H
+
+// Private SIMD search kernels shared by the vector sources. x86 builds use
+// SSE2, or AVX2 when the CPU supports it; other targets use scalar loops.
+//
+// Every kernel scans n elements in order and, for each element equal to
+// target, stores its index in indexes while fewer than capacity have been
+// stored. It stops after limit matches and returns how many it found, so a
+// limit of 1 finds the first match and SIZE_MAX counts all of them.
+// Floating-point elements compare with ==, so NaN matches nothing.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Check once whether both the CPU and the OS support AVX2.
+ *
+ * @return True if AVX2 code can run.
+ */
+bool fscl_simd_has_avx2(void);
+
+size_t fscl_simd_find_i32(const int32_t* data, size_t n, int32_t target, size_t* indexes, size_t capacity, size_t limit);
+size_t fscl_simd_find_i64(const int64_t* data, size_t n, int64_t target, size_t* indexes, size_t capacity, size_t limit);
+size_t fscl_simd_find_f32(const float* data, size_t n, float target, size_t* indexes, size_t capacity, size_t limit);
+size_t fscl_simd_find_f64(const double* data, size_t n, double target, size_t* indexes, size_t capacity, size_t limit);
+
+/**
+ * Search payloads laid out stride bytes apart, such as one field of an
+ * array of structures. AVX2 gathers four or eight payloads per instruction.
+ *
+ * @param base   Address of the first payload, aligned to its size.
+ * @param stride Distance in bytes between consecutive payloads.
+ */
+size_t fscl_simd_find_strided_i32(const void* base, size_t stride, size_t n, int32_t target, size_t* indexes, size_t capacity, size_t limit);
+size_t fscl_simd_find_strided_f32(const void* base, size_t stride, size_t n, float target, size_t* indexes, size_t capacity, size_t limit);
+size_t fscl_simd_find_strided_f64(const void* base, size_t stride, size_t n, double target, size_t* indexes, size_t capacity, size_t limit);
+
+#endif
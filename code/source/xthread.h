@@ -0,0 +1,232 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#ifndef fscl_xthread_H
+#define fscl_xthread_H
+
+// Private threading helpers shared by the library sources. POSIX threads are
+// used everywhere except Windows, which maps onto the native slim locks.
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#include <stdint.h>
+
+// Size of a cache line, used to keep independently locked data apart
+#define FSCL_CACHE_LINE 64
+
+// Storage class for per-thread variables
+#if defined(_MSC_VER) && !defined(__clang__)
+#define FSCL_THREAD_LOCAL __declspec(thread)
+#else
+#define FSCL_THREAD_LOCAL _Thread_local
+#endif
+
+// =======================
+// READER-WRITER LOCKS
+// =======================
+
+#if defined(_WIN32)
+typedef SRWLOCK fscl_rwlock;
+#define FSCL_RWLOCK_INIT SRWLOCK_INIT
+
+static inline bool fscl_rwlock_init(fscl_rwlock* lock) {
+    InitializeSRWLock(lock);
+    return true;
+}
+
+static inline void fscl_rwlock_destroy(fscl_rwlock* lock) {
+    (void)lock; // Slim locks own no resources
+}
+
+static inline void fscl_rwlock_read_lock(fscl_rwlock* lock) {
+    AcquireSRWLockShared(lock);
+}
+
+static inline void fscl_rwlock_read_unlock(fscl_rwlock* lock) {
+    ReleaseSRWLockShared(lock);
+}
+
+static inline void fscl_rwlock_write_lock(fscl_rwlock* lock) {
+    AcquireSRWLockExclusive(lock);
+}
+
+static inline void fscl_rwlock_write_unlock(fscl_rwlock* lock) {
+    ReleaseSRWLockExclusive(lock);
+}
+#else
+typedef pthread_rwlock_t fscl_rwlock;
+#define FSCL_RWLOCK_INIT PTHREAD_RWLOCK_INITIALIZER
+
+static inline bool fscl_rwlock_init(fscl_rwlock* lock) {
+    return pthread_rwlock_init(lock, NULL) == 0;
+}
+
+static inline void fscl_rwlock_destroy(fscl_rwlock* lock) {
+    pthread_rwlock_destroy(lock);
+}
+
+static inline void fscl_rwlock_read_lock(fscl_rwlock* lock) {
+    pthread_rwlock_rdlock(lock);
+}
+
+static inline void fscl_rwlock_read_unlock(fscl_rwlock* lock) {
+    pthread_rwlock_unlock(lock);
+}
+
+static inline void fscl_rwlock_write_lock(fscl_rwlock* lock) {
+    pthread_rwlock_wrlock(lock);
+}
+
+static inline void fscl_rwlock_write_unlock(fscl_rwlock* lock) {
+    pthread_rwlock_unlock(lock);
+}
+#endif
+
+// =======================
+// ATOMICS
+// =======================
+
+// Loads acquire and stores release, so data written before a store is
+// visible to a thread that sees the stored value. MSVC gets the matching
+// Windows primitives, every other compiler the GCC builtins.
+
+#if defined(_MSC_VER) && !defined(__clang__)
+static inline void* fscl_atomic_load_ptr(void* const volatile* ptr) {
+    return ReadPointerAcquire((PVOID const volatile*)ptr);
+}
+
+static inline void fscl_atomic_store_ptr(void* volatile* ptr, void* value) {
+    WritePointerRelease((PVOID volatile*)ptr, value);
+}
+
+static inline uint64_t fscl_atomic_load_u64(const volatile uint64_t* ptr) {
+    return (uint64_t)ReadAcquire64((LONG64 const volatile*)ptr);
+}
+
+static inline void fscl_atomic_store_u64(volatile uint64_t* ptr, uint64_t value) {
+    WriteRelease64((LONG64 volatile*)ptr, (LONG64)value);
+}
+
+static inline uint64_t fscl_atomic_fetch_add_u64(volatile uint64_t* ptr, uint64_t value) {
+    return (uint64_t)InterlockedExchangeAdd64((LONG64 volatile*)ptr, (LONG64)value);
+}
+
+static inline void fscl_atomic_fence(void) {
+    MemoryBarrier();
+}
+#else
+static inline void* fscl_atomic_load_ptr(void* const volatile* ptr) {
+    return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+
+static inline void fscl_atomic_store_ptr(void* volatile* ptr, void* value) {
+    __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+}
+
+static inline uint64_t fscl_atomic_load_u64(const volatile uint64_t* ptr) {
+    return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+
+static inline void fscl_atomic_store_u64(volatile uint64_t* ptr, uint64_t value) {
+    __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+}
+
+static inline uint64_t fscl_atomic_fetch_add_u64(volatile uint64_t* ptr, uint64_t value) {
+    return __atomic_fetch_add(ptr, value, __ATOMIC_SEQ_CST);
+}
+
+static inline void fscl_atomic_fence(void) {
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+#endif
+
+// =======================
+// EPOCH RECLAMATION
+// =======================
+
+// Readers announce the epoch they started in while they hold pointers to
+// shared memory. Writers unlink memory, advance the epoch and free it once
+// every announced epoch has moved past the one it was unlinked in. Reading
+// costs two plain stores and a fence, with no lock and no atomic
+// read-modify-write, on a record owned by the calling thread.
+
+typedef struct fscl_epoch_record fscl_epoch_record;
+
+/**
+ * Start a read-side critical section on the calling thread.
+ *
+ * @return The record of the calling thread, or NULL if it could not be registered.
+ */
+fscl_epoch_record* fscl_epoch_enter(void);
+
+/**
+ * End a read-side critical section started by fscl_epoch_enter.
+ *
+ * @param record The record returned by fscl_epoch_enter.
+ */
+void fscl_epoch_exit(fscl_epoch_record* record);
+
+/**
+ * Advance the global epoch after unlinking memory from a shared structure.
+ *
+ * @return The epoch to tag the unlinked memory with.
+ */
+uint64_t fscl_epoch_advance(void);
+
+/**
+ * Get the oldest epoch any reader is still inside.
+ *
+ * @return The oldest announced epoch, or UINT64_MAX when no reader is active.
+ *         Memory tagged with a smaller epoch is safe to free.
+ */
+uint64_t fscl_epoch_oldest(void);
+
+// =======================
+// PARALLEL TASKS
+// =======================
+
+// Fork-join helper for the parallel algorithms: a job is split into count
+// tasks by index, which the caller and a shared pool of worker threads
+// claim one at a time. The pool starts one worker per extra processor on
+// first use and keeps them for the life of the process, so a job costs a
+// wake-up rather than a thread start. Tasks of a job must not wait on
+// each other, since any of them may run on the calling thread.
+
+typedef void (*fscl_parallel_fn)(void* context, size_t index);
+
+/**
+ * Get the number of processors available to the process.
+ *
+ * @return The processor count, at least 1.
+ */
+size_t fscl_parallel_cpu_count(void);
+
+/**
+ * Run task(context, i) for every i below count on the shared pool and
+ * return once all of them have finished. Nested calls, calls made while
+ * another thread's job holds the pool, and calls on a machine with one
+ * processor run every task on the calling thread.
+ *
+ * @param count   The number of tasks.
+ * @param task    The function run for each task index.
+ * @param context Pointer passed through to task.
+ */
+void fscl_parallel_run(size_t count, fscl_parallel_fn task, void* context);
+
+#endif
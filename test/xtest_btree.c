@@ -0,0 +1,208 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/xstructures/btree.h" // lib source code
+
+#include <fossil/xtest.h>   // basic test tools
+#include <fossil/xassert.h> // extra asserts
+
+//
+// XUNIT TEST CASES
+//
+XTEST_CASE(test_btree_create_and_erase) {
+    cbtree* tree = fscl_btree_create(TOFU_INT_TYPE);
+
+    TEST_ASSERT_NOT_CNULLPTR(tree);
+    TEST_ASSERT_TRUE(fscl_btree_is_empty(tree));
+    cbtree_cursor cursor = fscl_btree_cursor_start(tree);
+    TEST_ASSERT_FALSE(fscl_btree_cursor_valid(&cursor));
+
+    fscl_btree_erase(tree);
+}
+
+XTEST_CASE(test_btree_insert_and_getter) {
+    cbtree* tree = fscl_btree_create(TOFU_INT_TYPE);
+
+    // Enough keys to split leaves and inner nodes
+    const int count = 1000;
+    for (int i = 0; i < count; i++) {
+        ctofu key = { TOFU_INT_TYPE, { .int_type = (i * 7919) % count } };
+        ctofu value = { TOFU_INT_TYPE, { .int_type = key.data.int_type * 2 } };
+        TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_btree_insert(tree, key, value));
+    }
+    TEST_ASSERT_EQUAL(count, fscl_btree_size(tree));
+
+    ctofu key = { TOFU_INT_TYPE, { .int_type = 123 } };
+    ctofu value = { TOFU_INT_TYPE, { .int_type = 5 } };
+    ctofu result;
+    TEST_ASSERT_EQUAL(TOFU_WAS_MISMATCH, fscl_btree_insert(tree, key, value));
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_btree_getter(tree, key, &result));
+    TEST_ASSERT_EQUAL_INT(246, result.data.int_type);
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_btree_setter(tree, key, value));
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_btree_getter(tree, key, &result));
+    TEST_ASSERT_EQUAL_INT(5, result.data.int_type);
+
+    // The cursor walks every key in ascending order
+    int expected = 0;
+    for (cbtree_cursor cursor = fscl_btree_cursor_start(tree); fscl_btree_cursor_valid(&cursor); fscl_btree_cursor_next(&cursor)) {
+        TEST_ASSERT_EQUAL_INT(expected, fscl_btree_cursor_key(&cursor)->data.int_type);
+        expected++;
+    }
+    TEST_ASSERT_EQUAL_INT(count, expected);
+
+    fscl_btree_erase(tree);
+}
+
+XTEST_CASE(test_btree_bounds_and_range) {
+    cbtree* tree = fscl_btree_create(TOFU_INT_TYPE);
+
+    // Even keys from 0 to 198
+    for (int i = 0; i < 100; i++) {
+        ctofu key = { TOFU_INT_TYPE, { .int_type = i * 2 } };
+        fscl_btree_insert(tree, key, key);
+    }
+
+    ctofu key50 = { TOFU_INT_TYPE, { .int_type = 50 } };
+    ctofu key51 = { TOFU_INT_TYPE, { .int_type = 51 } };
+    ctofu key198 = { TOFU_INT_TYPE, { .int_type = 198 } };
+
+    cbtree_cursor cursor = fscl_btree_lower_bound(tree, key50);
+    TEST_ASSERT_EQUAL_INT(50, fscl_btree_cursor_key(&cursor)->data.int_type);
+    cursor = fscl_btree_upper_bound(tree, key50);
+    TEST_ASSERT_EQUAL_INT(52, fscl_btree_cursor_key(&cursor)->data.int_type);
+    cursor = fscl_btree_lower_bound(tree, key51);
+    TEST_ASSERT_EQUAL_INT(52, fscl_btree_cursor_key(&cursor)->data.int_type);
+    cursor = fscl_btree_upper_bound(tree, key198);
+    TEST_ASSERT_FALSE(fscl_btree_cursor_valid(&cursor));
+    TEST_ASSERT_CNULLPTR(fscl_btree_cursor_key(&cursor));
+
+    // Keys 51 up to but not including 101
+    ctofu key101 = { TOFU_INT_TYPE, { .int_type = 101 } };
+    int visited = 0;
+    int sum = 0;
+    for (cursor = fscl_btree_range(tree, key51, key101); fscl_btree_cursor_valid(&cursor); fscl_btree_cursor_next(&cursor)) {
+        sum += fscl_btree_cursor_value(&cursor)->data.int_type;
+        visited++;
+    }
+    TEST_ASSERT_EQUAL_INT(25, visited);
+    TEST_ASSERT_EQUAL_INT(1900, sum);
+
+    fscl_btree_erase(tree);
+}
+
+XTEST_CASE(test_btree_remove) {
+    cbtree* tree = fscl_btree_create(TOFU_INT_TYPE);
+
+    const int count = 500;
+    for (int i = 0; i < count; i++) {
+        ctofu key = { TOFU_INT_TYPE, { .int_type = i } };
+        fscl_btree_insert(tree, key, key);
+    }
+
+    // Removing every odd key merges and borrows between nodes
+    for (int i = 1; i < count; i += 2) {
+        ctofu key = { TOFU_INT_TYPE, { .int_type = i } };
+        TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_btree_remove(tree, key));
+        TEST_ASSERT_EQUAL(TOFU_NOT_FOUND, fscl_btree_remove(tree, key));
+    }
+    TEST_ASSERT_EQUAL(count / 2, fscl_btree_size(tree));
+
+    int expected = 0;
+    for (cbtree_cursor cursor = fscl_btree_cursor_start(tree); fscl_btree_cursor_valid(&cursor); fscl_btree_cursor_next(&cursor)) {
+        TEST_ASSERT_EQUAL_INT(expected, fscl_btree_cursor_key(&cursor)->data.int_type);
+        expected += 2;
+    }
+
+    for (int i = 0; i < count; i += 2) {
+        ctofu key = { TOFU_INT_TYPE, { .int_type = i } };
+        TEST_ASSERT_TRUE(fscl_btree_contains(tree, key));
+        TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_btree_remove(tree, key));
+    }
+    TEST_ASSERT_TRUE(fscl_btree_is_empty(tree));
+
+    fscl_btree_erase(tree);
+}
+
+// Helper of test_btree_splits: the depth of every leaf below node, or -1
+// when leaves sit at different depths or a node holds keys out of order
+static int test_btree_depth(const cbtree_node* node) {
+    for (size_t i = 1; i < node->count; i++) {
+        if (fscl_tofu_compare(&node->keys[i - 1], &node->keys[i]) >= 0) {
+            return -1;
+        }
+    }
+
+    if (node->leaf) {
+        return 1;
+    }
+
+    const cbtree_inner* inner = (const cbtree_inner*)node;
+    int depth = test_btree_depth(inner->children[0]);
+    for (size_t i = 1; i <= node->count; i++) {
+        if (depth < 0 || test_btree_depth(inner->children[i]) != depth) {
+            return -1;
+        }
+    }
+
+    return depth < 0 ? -1 : depth + 1;
+}
+
+XTEST_CASE(test_btree_splits) {
+    cbtree* tree = fscl_btree_create(TOFU_INT_TYPE);
+
+    // A scattered insertion order splits leaves and inner nodes at every
+    // position, and grows the root several times
+    const int count = 5000;
+    for (int i = 0; i < count; i++) {
+        ctofu key = { TOFU_INT_TYPE, { .int_type = (i * 7919) % count } };
+        TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_btree_insert(tree, key, key));
+        TEST_ASSERT_EQUAL(TOFU_WAS_MISMATCH, fscl_btree_insert(tree, key, key));
+    }
+    TEST_ASSERT_EQUAL(count, fscl_btree_size(tree));
+    TEST_ASSERT_TRUE(test_btree_depth(tree->root) >= 3);
+
+    // Keys of another type have no order against the stored ones
+    ctofu wrong = { TOFU_DOUBLE_TYPE, { .double_type = 1.0 } };
+    ctofu value;
+    TEST_ASSERT_EQUAL(TOFU_WAS_MISMATCH, fscl_btree_insert(tree, wrong, wrong));
+    TEST_ASSERT_EQUAL(TOFU_WAS_MISMATCH, fscl_btree_remove(tree, wrong));
+    TEST_ASSERT_EQUAL(TOFU_WAS_MISMATCH, fscl_btree_search(tree, wrong));
+    TEST_ASSERT_EQUAL(TOFU_WAS_MISMATCH, fscl_btree_getter(tree, wrong, &value));
+    TEST_ASSERT_FALSE(fscl_btree_contains(tree, wrong));
+    cbtree_cursor cursor = fscl_btree_lower_bound(tree, wrong);
+    TEST_ASSERT_FALSE(fscl_btree_cursor_valid(&cursor));
+    TEST_ASSERT_EQUAL(count, fscl_btree_size(tree));
+
+    // The leaf chain holds every pair exactly once, in order
+    int expected = 0;
+    for (const cbtree_leaf* leaf = tree->first; leaf != NULL; leaf = leaf->next) {
+        for (size_t i = 0; i < leaf->node.count; i++) {
+            TEST_ASSERT_EQUAL_INT(expected, leaf->node.keys[i].data.int_type);
+            TEST_ASSERT_EQUAL_INT(expected, leaf->values[i].data.int_type);
+            expected++;
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(count, expected);
+
+    fscl_btree_erase(tree);
+}
+
+//
+// XUNIT-TEST RUNNER
+//
+XTEST_DEFINE_POOL(xdata_test_btree_group) {
+    XTEST_RUN_UNIT(test_btree_create_and_erase);
+    XTEST_RUN_UNIT(test_btree_insert_and_getter);
+    XTEST_RUN_UNIT(test_btree_bounds_and_range);
+    XTEST_RUN_UNIT(test_btree_remove);
+    XTEST_RUN_UNIT(test_btree_splits);
+} // end of func
@@ -0,0 +1,164 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/xstructures/cache.h" // lib source code
+
+#include <fossil/xtest.h>   // basic test tools
+#include <fossil/xassert.h> // extra asserts
+
+// Records the keys a cache evicts
+typedef struct {
+    int keys[16];
+    int count;
+} evict_log;
+
+static void record_eviction(const ctofu* key, const ctofu* value, void* context) {
+    (void)value;
+    evict_log* log = (evict_log*)context;
+    log->keys[log->count++] = key->data.int_type;
+}
+
+//
+// XUNIT TEST CASES
+//
+XTEST_CASE(test_cache_create_and_erase) {
+    TEST_ASSERT_CNULLPTR(fscl_cache_create(TOFU_INT_TYPE, 0, CACHE_POLICY_LRU));
+
+    ccache* cache = fscl_cache_create(TOFU_INT_TYPE, 4, CACHE_POLICY_LRU);
+    TEST_ASSERT_NOT_CNULLPTR(cache);
+    TEST_ASSERT_TRUE(fscl_cache_is_empty(cache));
+    TEST_ASSERT_EQUAL(4, fscl_cache_capacity(cache));
+
+    fscl_cache_erase(cache);
+}
+
+XTEST_CASE(test_cache_get_and_put) {
+    ccache* cache = fscl_cache_create(TOFU_INT_TYPE, 4, CACHE_POLICY_LRU);
+
+    ctofu key = { TOFU_INT_TYPE, { .int_type = 1 } };
+    ctofu value = { TOFU_INT_TYPE, { .int_type = 10 } };
+    ctofu updatedValue = { TOFU_INT_TYPE, { .int_type = 20 } };
+    ctofu missingKey = { TOFU_INT_TYPE, { .int_type = 2 } };
+    ctofu result;
+
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_cache_put(cache, key, value));
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_cache_get(cache, key, &result));
+    TEST_ASSERT_EQUAL_INT(10, result.data.int_type);
+
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_cache_put(cache, key, updatedValue));
+    TEST_ASSERT_EQUAL(1, fscl_cache_size(cache));
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_cache_get(cache, key, &result));
+    TEST_ASSERT_EQUAL_INT(20, result.data.int_type);
+    TEST_ASSERT_EQUAL(TOFU_NOT_FOUND, fscl_cache_get(cache, missingKey, &result));
+
+    ccache_stats stats = fscl_cache_stats(cache);
+    TEST_ASSERT_EQUAL(2, stats.hits);
+    TEST_ASSERT_EQUAL(1, stats.misses);
+    TEST_ASSERT_EQUAL(0, stats.evictions);
+
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_cache_remove(cache, key));
+    TEST_ASSERT_EQUAL(TOFU_NOT_FOUND, fscl_cache_remove(cache, key));
+    TEST_ASSERT_FALSE(fscl_cache_contains(cache, key));
+    TEST_ASSERT_TRUE(fscl_cache_is_empty(cache));
+
+    fscl_cache_erase(cache);
+}
+
+XTEST_CASE(test_cache_lru_eviction) {
+    ccache* cache = fscl_cache_create(TOFU_INT_TYPE, 3, CACHE_POLICY_LRU);
+    evict_log log = { { 0 }, 0 };
+    fscl_cache_set_evict_callback(cache, record_eviction, &log);
+
+    for (int i = 0; i < 3; i++) {
+        ctofu key = { TOFU_INT_TYPE, { .int_type = i } };
+        fscl_cache_put(cache, key, key);
+    }
+
+    // Using key 0 makes key 1 the least recently used
+    ctofu key0 = { TOFU_INT_TYPE, { .int_type = 0 } };
+    ctofu result;
+    fscl_cache_get(cache, key0, &result);
+
+    ctofu key3 = { TOFU_INT_TYPE, { .int_type = 3 } };
+    ctofu key4 = { TOFU_INT_TYPE, { .int_type = 4 } };
+    fscl_cache_put(cache, key3, key3);
+    fscl_cache_put(cache, key4, key4);
+
+    TEST_ASSERT_EQUAL(3, fscl_cache_size(cache));
+    TEST_ASSERT_EQUAL(2, log.count);
+    TEST_ASSERT_EQUAL_INT(1, log.keys[0]);
+    TEST_ASSERT_EQUAL_INT(2, log.keys[1]);
+    TEST_ASSERT_TRUE(fscl_cache_contains(cache, key0));
+    TEST_ASSERT_EQUAL(2, fscl_cache_stats(cache).evictions);
+
+    fscl_cache_erase(cache);
+}
+
+XTEST_CASE(test_cache_clock_eviction) {
+    ccache* cache = fscl_cache_create(TOFU_INT_TYPE, 3, CACHE_POLICY_CLOCK);
+    evict_log log = { { 0 }, 0 };
+    fscl_cache_set_evict_callback(cache, record_eviction, &log);
+
+    for (int i = 0; i < 3; i++) {
+        ctofu key = { TOFU_INT_TYPE, { .int_type = i } };
+        fscl_cache_put(cache, key, key);
+    }
+
+    // Referenced keys get a second chance, so key 1 goes first
+    ctofu key0 = { TOFU_INT_TYPE, { .int_type = 0 } };
+    ctofu key3 = { TOFU_INT_TYPE, { .int_type = 3 } };
+    ctofu result;
+    fscl_cache_get(cache, key0, &result);
+    fscl_cache_put(cache, key3, key3);
+
+    TEST_ASSERT_EQUAL(1, log.count);
+    TEST_ASSERT_EQUAL_INT(1, log.keys[0]);
+    TEST_ASSERT_TRUE(fscl_cache_contains(cache, key0));
+    TEST_ASSERT_TRUE(fscl_cache_contains(cache, key3));
+
+    fscl_cache_erase(cache);
+}
+
+XTEST_CASE(test_cache_churn) {
+    ccache* cache = fscl_cache_create(TOFU_INT_TYPE, 64, CACHE_POLICY_LRU);
+
+    // Constant eviction keeps every key reachable through the index
+    for (int i = 0; i < 10000; i++) {
+        ctofu key = { TOFU_INT_TYPE, { .int_type = i } };
+        fscl_cache_put(cache, key, key);
+    }
+
+    TEST_ASSERT_EQUAL(64, fscl_cache_size(cache));
+    for (int i = 10000 - 64; i < 10000; i++) {
+        ctofu key = { TOFU_INT_TYPE, { .int_type = i } };
+        ctofu result;
+        TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_cache_get(cache, key, &result));
+        TEST_ASSERT_EQUAL_INT(i, result.data.int_type);
+    }
+
+    fscl_cache_clear(cache);
+    TEST_ASSERT_TRUE(fscl_cache_is_empty(cache));
+    TEST_ASSERT_EQUAL(10000 - 64, fscl_cache_stats(cache).evictions);
+
+    fscl_cache_erase(cache);
+}
+
+//
+// XUNIT-TEST RUNNER
+//
+XTEST_DEFINE_POOL(xdata_test_cache_group) {
+    XTEST_RUN_UNIT(test_cache_create_and_erase);
+    XTEST_RUN_UNIT(test_cache_get_and_put);
+    XTEST_RUN_UNIT(test_cache_lru_eviction);
+    XTEST_RUN_UNIT(test_cache_clock_eviction);
+    XTEST_RUN_UNIT(test_cache_churn);
+} // end of func
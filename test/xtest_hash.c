@@ -0,0 +1,116 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/xstructures/hash.h" // lib source code
+
+#include <fossil/xtest.h>   // basic test tools
+#include <fossil/xassert.h> // extra asserts
+
+//
+// XUNIT TEST CASES
+//
+XTEST_CASE(test_hash_equal_values_hash_alike) {
+    ctofu int1 = { TOFU_INT_TYPE, { .int_type = 42 } };
+    ctofu int2 = { TOFU_INT_TYPE, { .int_type = 42 } };
+    ctofu int3 = { TOFU_INT_TYPE, { .int_type = 43 } };
+
+    // Equal integers share a hash, different ones do not
+    TEST_ASSERT_TRUE(fscl_tofu_hash(&int1, TOFU_HASH_SEED) == fscl_tofu_hash(&int2, TOFU_HASH_SEED));
+    TEST_ASSERT_FALSE(fscl_tofu_hash(&int1, TOFU_HASH_SEED) == fscl_tofu_hash(&int3, TOFU_HASH_SEED));
+
+    // Strings hash by content, not by address
+    char buffer1[] = "fossil logic";
+    char buffer2[] = "fossil logic";
+    ctofu string1 = { TOFU_STRING_TYPE, { .string_type = buffer1 } };
+    ctofu string2 = { TOFU_STRING_TYPE, { .string_type = buffer2 } };
+    TEST_ASSERT_TRUE(fscl_tofu_hash(&string1, TOFU_HASH_SEED) == fscl_tofu_hash(&string2, TOFU_HASH_SEED));
+
+    // The seed changes the result
+    TEST_ASSERT_FALSE(fscl_tofu_hash(&int1, 1) == fscl_tofu_hash(&int1, 2));
+}
+
+XTEST_CASE(test_hash_canonical_floats) {
+    ctofu zero = { TOFU_DOUBLE_TYPE, { .double_type = 0.0 } };
+    ctofu negativeZero = { TOFU_DOUBLE_TYPE, { .double_type = -0.0 } };
+
+    // Negative zero compares equal to zero, so it must hash alike
+    TEST_ASSERT_TRUE(fscl_tofu_hash(&zero, TOFU_HASH_SEED) == fscl_tofu_hash(&negativeZero, TOFU_HASH_SEED));
+    TEST_ASSERT_TRUE(fscl_tofu_hash_double(0.0, 7) == fscl_tofu_hash_double(-0.0, 7));
+    TEST_ASSERT_FALSE(fscl_tofu_hash_double(1.0, 7) == fscl_tofu_hash_double(-1.0, 7));
+}
+
+XTEST_CASE(test_hash_bytes_lengths) {
+    const char text[] = "the quick brown fox jumps over the lazy dog, twice over and then some";
+
+    // Every prefix length takes a different path through the hash
+    for (size_t length = 1; length < sizeof(text) - 1; ++length) {
+        uint64_t shorter = fscl_tofu_hash_bytes(text, length - 1, TOFU_HASH_SEED);
+        uint64_t longer = fscl_tofu_hash_bytes(text, length, TOFU_HASH_SEED);
+        TEST_ASSERT_FALSE(shorter == longer);
+        TEST_ASSERT_TRUE(longer == fscl_tofu_hash_bytes(text, length, TOFU_HASH_SEED));
+    }
+}
+
+XTEST_CASE(test_hash_cached_values) {
+    ctofu key1 = { TOFU_INT_TYPE, { .int_type = 7 } };
+    ctofu key2 = { TOFU_INT_TYPE, { .int_type = 8 } };
+
+    ctofu_hashed hashed1 = fscl_tofu_hashed(key1, TOFU_HASH_SEED);
+    ctofu_hashed hashed2 = fscl_tofu_hashed(key1, TOFU_HASH_SEED);
+    ctofu_hashed hashed3 = fscl_tofu_hashed(key2, TOFU_HASH_SEED);
+
+    TEST_ASSERT_TRUE(hashed1.hash == fscl_tofu_hash(&key1, TOFU_HASH_SEED));
+    TEST_ASSERT_TRUE(fscl_tofu_hashed_equal(&hashed1, &hashed2));
+    TEST_ASSERT_FALSE(fscl_tofu_hashed_equal(&hashed1, &hashed3));
+}
+
+XTEST_CASE(test_hash_integer_payloads_spread) {
+    enum { KEY_COUNT = 256, BUCKET_COUNT = 16 };
+    ctofu_type types[] = { TOFU_OCTAL_TYPE, TOFU_HEX_TYPE, TOFU_BIT_TYPE };
+
+    // Octal, hex and bit keys carry integers, so they must not collide
+    for (size_t t = 0; t < sizeof(types) / sizeof(types[0]); ++t) {
+        size_t buckets[BUCKET_COUNT] = { 0 };
+        for (int i = 0; i < KEY_COUNT; ++i) {
+            ctofu key = { types[t], { .int_type = i } };
+            if (types[t] == TOFU_OCTAL_TYPE) key.data.octal_type = i;
+            if (types[t] == TOFU_HEX_TYPE) key.data.hex_type = i;
+            if (types[t] == TOFU_BIT_TYPE) key.data.bit_type = i;
+            buckets[fscl_tofu_hash(&key, TOFU_HASH_SEED) % BUCKET_COUNT]++;
+        }
+
+        size_t used = 0;
+        size_t largest = 0;
+        for (size_t b = 0; b < BUCKET_COUNT; ++b) {
+            used += buckets[b] != 0;
+            largest = buckets[b] > largest ? buckets[b] : largest;
+        }
+        TEST_ASSERT_TRUE(used == BUCKET_COUNT);
+        TEST_ASSERT_TRUE(largest < KEY_COUNT / 4);
+    }
+
+    // Equal hex payloads still hash alike
+    ctofu hex1 = { TOFU_HEX_TYPE, { .hex_type = 0xff } };
+    ctofu hex2 = { TOFU_HEX_TYPE, { .hex_type = 0xff } };
+    TEST_ASSERT_TRUE(fscl_tofu_hash(&hex1, TOFU_HASH_SEED) == fscl_tofu_hash(&hex2, TOFU_HASH_SEED));
+}
+
+//
+// XUNIT-TEST RUNNER
+//
+XTEST_DEFINE_POOL(xdata_test_hash_group) {
+    XTEST_RUN_UNIT(test_hash_equal_values_hash_alike);
+    XTEST_RUN_UNIT(test_hash_canonical_floats);
+    XTEST_RUN_UNIT(test_hash_bytes_lengths);
+    XTEST_RUN_UNIT(test_hash_cached_values);
+    XTEST_RUN_UNIT(test_hash_integer_payloads_spread);
+} // end of func
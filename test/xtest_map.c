@@ -10,11 +10,39 @@ Description:
     feel free to contact Michael at michaelbrockus@gmail.com.
 ==============================================================================
 */
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L // Threads under strict ISO C
+#endif
 #include "fossil/xstructures/map.h" // lib source code
 
 #include <fossil/xtest.h>   // basic test tools
 #include <fossil/xassert.h> // extra asserts
 
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+typedef HANDLE map_test_thread;
+#define MAP_TEST_THREAD_RETURN DWORD WINAPI
+#else
+#include <pthread.h>
+typedef pthread_t map_test_thread;
+#define MAP_TEST_THREAD_RETURN void*
+#endif
+
+#define MAP_TEST_THREADS 4
+#define MAP_TEST_SHARED_KEYS 1000
+#define MAP_TEST_OWN_KEYS 2000
+
+// Work of one thread against a shared map: it owns a range of keys that no
+// other thread writes, and reads the shared keys and the other ranges
+typedef struct {
+    cmap* map;
+    int first;
+    size_t errors;
+} map_test_worker;
+
 //
 // XUNIT TEST CASES
 //
@@ -119,6 +147,588 @@ XTEST_CASE(test_map_contains) {
     fscl_map_erase(map);
 }
 
+XTEST_CASE(test_map_grows_past_initial_capacity) {
+    cmap* map = fscl_map_create(TOFU_INT_TYPE);
+
+    // Insert far more pairs than the initial index can hold
+    for (int i = 0; i < 5000; ++i) {
+        ctofu key = { TOFU_INT_TYPE, { .int_type = i } };
+        ctofu value = { TOFU_INT_TYPE, { .int_type = i * 2 } };
+        TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_insert(map, key, value));
+    }
+
+    TEST_ASSERT_EQUAL_UINT(5000, fscl_map_size(map));
+
+    // Every key must still resolve to its own value
+    for (int i = 0; i < 5000; ++i) {
+        ctofu key = { TOFU_INT_TYPE, { .int_type = i } };
+        ctofu retrievedValue;
+        TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_getter(map, key, &retrievedValue));
+        TEST_ASSERT_EQUAL_INT(i * 2, retrievedValue.data.int_type);
+    }
+
+    // Duplicate keys are still rejected
+    ctofu duplicate = { TOFU_INT_TYPE, { .int_type = 1234 } };
+    TEST_ASSERT_EQUAL(TOFU_WAS_MISMATCH, fscl_map_insert(map, duplicate, duplicate));
+
+    fscl_map_erase(map);
+}
+
+XTEST_CASE(test_map_remove_and_iterate) {
+    cmap* map = fscl_map_create(TOFU_INT_TYPE);
+
+    for (int i = 0; i < 200; ++i) {
+        ctofu key = { TOFU_INT_TYPE, { .int_type = i } };
+        fscl_map_insert(map, key, key);
+    }
+
+    // Remove every even key
+    for (int i = 0; i < 200; i += 2) {
+        ctofu key = { TOFU_INT_TYPE, { .int_type = i } };
+        TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_remove(map, key));
+    }
+
+    TEST_ASSERT_EQUAL_UINT(100, fscl_map_size(map));
+
+    // Only odd keys remain, each paired with its own value
+    size_t visited = 0;
+    for (ctofu_iterator it = fscl_map_iterator_start(map); fscl_map_iterator_has_next(it); it = fscl_map_iterator_next(it)) {
+        TEST_ASSERT_EQUAL_INT(1, it.current_key->data.int_type % 2);
+        TEST_ASSERT_EQUAL_INT(it.current_key->data.int_type, it.current_value->data.int_type);
+        visited++;
+    }
+    TEST_ASSERT_EQUAL_UINT(100, visited);
+    TEST_ASSERT_FALSE(fscl_map_iterator_has_next(fscl_map_iterator_end(map)));
+
+    ctofu removed = { TOFU_INT_TYPE, { .int_type = 42 } };
+    ctofu kept = { TOFU_INT_TYPE, { .int_type = 43 } };
+    TEST_ASSERT_FALSE(fscl_map_contains(map, removed));
+    TEST_ASSERT_TRUE(fscl_map_contains(map, kept));
+    TEST_ASSERT_EQUAL(TOFU_NOT_FOUND, fscl_map_remove(map, removed));
+
+    fscl_map_erase(map);
+}
+
+XTEST_CASE(test_map_swiss_mode) {
+    cmap* map = fscl_map_create_swiss(TOFU_INT_TYPE);
+    TEST_ASSERT_NOT_CNULLPTR(map);
+
+    for (int i = 0; i < 3000; ++i) {
+        ctofu key = { TOFU_INT_TYPE, { .int_type = i } };
+        ctofu value = { TOFU_INT_TYPE, { .int_type = -i } };
+        TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_insert(map, key, value));
+    }
+
+    // Remove a third of the keys so lookups have to probe past tombstones
+    for (int i = 0; i < 3000; i += 3) {
+        ctofu key = { TOFU_INT_TYPE, { .int_type = i } };
+        TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_remove(map, key));
+    }
+
+    TEST_ASSERT_EQUAL_UINT(2000, fscl_map_size(map));
+
+    for (int i = 0; i < 3000; ++i) {
+        ctofu key = { TOFU_INT_TYPE, { .int_type = i } };
+        ctofu retrievedValue;
+        if (i % 3 == 0) {
+            TEST_ASSERT_FALSE(fscl_map_contains(map, key));
+        } else {
+            TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_getter(map, key, &retrievedValue));
+            TEST_ASSERT_EQUAL_INT(-i, retrievedValue.data.int_type);
+        }
+    }
+
+    fscl_map_erase(map);
+}
+
+XTEST_CASE(test_map_incremental_resize) {
+    cmap* map = fscl_map_create(TOFU_INT_TYPE);
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_set_incremental(map, true));
+
+    bool migrated = false;
+    for (int i = 0; i < 10000; ++i) {
+        ctofu key = { TOFU_INT_TYPE, { .int_type = i } };
+        TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_insert(map, key, key));
+
+        if (map->old_index.count == 0) {
+            continue;
+        }
+        migrated = true;
+
+        // Lookups and iteration stay correct while the old index drains
+        ctofu first = { TOFU_INT_TYPE, { .int_type = 0 } };
+        TEST_ASSERT_TRUE(fscl_map_contains(map, first));
+        TEST_ASSERT_TRUE(fscl_map_contains(map, key));
+
+        size_t visited = 0;
+        for (ctofu_iterator it = fscl_map_iterator_start(map); fscl_map_iterator_has_next(it); it = fscl_map_iterator_next(it)) {
+            visited++;
+        }
+        TEST_ASSERT_EQUAL_UINT(fscl_map_size(map), visited);
+    }
+    TEST_ASSERT_TRUE(migrated);
+
+    // Disabling the mode finishes the migration
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_set_incremental(map, false));
+    TEST_ASSERT_EQUAL_UINT(0, map->old_index.count);
+
+    for (int i = 0; i < 10000; ++i) {
+        ctofu key = { TOFU_INT_TYPE, { .int_type = i } };
+        TEST_ASSERT_TRUE(fscl_map_contains(map, key));
+    }
+
+    fscl_map_erase(map);
+}
+
+XTEST_CASE(test_map_entry_and_upsert) {
+    cmap* map = fscl_map_create(TOFU_INT_TYPE);
+
+    // A vacant handle is filled in place
+    ctofu key = { TOFU_INT_TYPE, { .int_type = 42 } };
+    ctofu value = { TOFU_INT_TYPE, { .int_type = 10 } };
+    cmap_entry entry = fscl_map_entry(map, key);
+    TEST_ASSERT_FALSE(fscl_map_entry_occupied(&entry));
+    TEST_ASSERT_CNULLPTR(fscl_map_entry_value(&entry));
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_entry_set(&entry, value));
+    TEST_ASSERT_TRUE(fscl_map_entry_occupied(&entry));
+    TEST_ASSERT_EQUAL_INT(10, fscl_map_entry_value(&entry)->data.int_type);
+
+    // Upsert overwrites existing keys and inserts new ones
+    ctofu updatedValue = { TOFU_INT_TYPE, { .int_type = 50 } };
+    ctofu otherKey = { TOFU_INT_TYPE, { .int_type = 7 } };
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_upsert(map, key, updatedValue));
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_upsert(map, otherKey, value));
+    TEST_ASSERT_EQUAL_UINT(2, fscl_map_size(map));
+
+    ctofu retrievedValue;
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_getter(map, key, &retrievedValue));
+    TEST_ASSERT_EQUAL_INT(50, retrievedValue.data.int_type);
+
+    // Counting with get_or_insert takes one lookup per increment
+    ctofu zero = { TOFU_INT_TYPE, { .int_type = 0 } };
+    for (int i = 0; i < 1000; ++i) {
+        ctofu bucket = { TOFU_INT_TYPE, { .int_type = 100 + i % 10 } };
+        ctofu* count = NULL;
+        TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_get_or_insert(map, bucket, zero, &count));
+        count->data.int_type++;
+    }
+
+    ctofu bucket = { TOFU_INT_TYPE, { .int_type = 103 } };
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_getter(map, bucket, &retrievedValue));
+    TEST_ASSERT_EQUAL_INT(100, retrievedValue.data.int_type);
+    TEST_ASSERT_EQUAL_UINT(12, fscl_map_size(map));
+
+    fscl_map_erase(map);
+}
+
+XTEST_CASE(test_map_entry_during_migration) {
+    // Reads between fscl_map_entry and fscl_map_entry_set migrate old
+    // slots, possibly into the slot the handle found free
+    for (int trial = 0; trial < 64; ++trial) {
+        cmap* map = trial % 2 == 0 ? fscl_map_create(TOFU_INT_TYPE) : fscl_map_create_swiss(TOFU_INT_TYPE);
+        TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_set_incremental(map, true));
+
+        int count = 0;
+        while (map->old_index.count == 0 || count < 2 * trial) {
+            ctofu key = { TOFU_INT_TYPE, { .int_type = count * 31 + trial } };
+            TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_insert(map, key, key));
+            count++;
+        }
+
+        ctofu absent = { TOFU_INT_TYPE, { .int_type = -1 - trial } };
+        cmap_entry entry = fscl_map_entry(map, absent);
+        TEST_ASSERT_FALSE(fscl_map_entry_occupied(&entry));
+        for (int i = 0; i < 100; ++i) {
+            ctofu key = { TOFU_INT_TYPE, { .int_type = (i % count) * 31 + trial } };
+            TEST_ASSERT_TRUE(fscl_map_contains(map, key));
+        }
+        TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_entry_set(&entry, absent));
+
+        // No key was overwritten in the index
+        TEST_ASSERT_EQUAL_UINT((size_t)count + 1, fscl_map_size(map));
+        TEST_ASSERT_TRUE(fscl_map_contains(map, absent));
+        for (int i = 0; i < count; ++i) {
+            ctofu key = { TOFU_INT_TYPE, { .int_type = i * 31 + trial } };
+            TEST_ASSERT_TRUE(fscl_map_contains(map, key));
+        }
+
+        fscl_map_erase(map);
+    }
+}
+
+XTEST_CASE(test_map_find_by_reference) {
+    cmap* map = fscl_map_create(TOFU_INT_TYPE);
+
+    ctofu key = { TOFU_INT_TYPE, { .int_type = 42 } };
+    ctofu value = { TOFU_INT_TYPE, { .int_type = 10 } };
+    ctofu missingKey = { TOFU_INT_TYPE, { .int_type = 100 } };
+
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_insert_ref(map, &key, &value));
+    TEST_ASSERT_EQUAL(TOFU_WAS_MISMATCH, fscl_map_insert_ref(map, &key, &value));
+
+    // The returned pointer refers to the stored value itself
+    const ctofu* found = fscl_map_find(map, &key);
+    TEST_ASSERT_NOT_CNULLPTR(found);
+    TEST_ASSERT_EQUAL_INT(10, found->data.int_type);
+    TEST_ASSERT_CNULLPTR(fscl_map_find(map, &missingKey));
+
+    ctofu updatedValue = { TOFU_INT_TYPE, { .int_type = 50 } };
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_setter_ref(map, &key, &updatedValue));
+    TEST_ASSERT_EQUAL_INT(50, fscl_map_find(map, &key)->data.int_type);
+
+    TEST_ASSERT_TRUE(fscl_map_contains_ref(map, &key));
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_remove_ref(map, &key));
+    TEST_ASSERT_FALSE(fscl_map_contains_ref(map, &key));
+
+    fscl_map_erase(map);
+}
+
+// Helper function for fscl_map_for_each that sums the integer values
+static bool sum_values(const ctofu* key, const ctofu* value, void* context) {
+    (void)key;
+    *(long long*)context += value->data.int_type;
+    return true;
+}
+
+XTEST_CASE(test_map_concurrent_mode) {
+    TEST_ASSERT_CNULLPTR(fscl_map_create_concurrent(TOFU_INT_TYPE, 0));
+
+    // Six shards round up to eight
+    cmap* map = fscl_map_create_concurrent(TOFU_INT_TYPE, 6);
+    TEST_ASSERT_NOT_CNULLPTR(map);
+    TEST_ASSERT_EQUAL(8, map->shard_count);
+
+    const int count = 2000;
+    for (int i = 0; i < count; i++) {
+        ctofu key = { TOFU_INT_TYPE, { .int_type = i } };
+        ctofu value = { TOFU_INT_TYPE, { .int_type = i } };
+        TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_insert(map, key, value));
+    }
+    TEST_ASSERT_EQUAL(count, fscl_map_size(map));
+
+    ctofu key = { TOFU_INT_TYPE, { .int_type = 7 } };
+    ctofu value = { TOFU_INT_TYPE, { .int_type = 70 } };
+    ctofu result;
+    TEST_ASSERT_EQUAL(TOFU_WAS_MISMATCH, fscl_map_insert(map, key, value));
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_setter(map, key, value));
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_getter(map, key, &result));
+    TEST_ASSERT_EQUAL_INT(70, result.data.int_type);
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_remove(map, key));
+    TEST_ASSERT_FALSE(fscl_map_contains(map, key));
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_upsert(map, key, value));
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_search(map, key));
+
+    // Pointers into a shard are not handed out
+    ctofu* stored = NULL;
+    TEST_ASSERT_CNULLPTR(fscl_map_find(map, &key));
+    TEST_ASSERT_EQUAL(TOFU_WAS_MISMATCH, fscl_map_get_or_insert(map, key, value, &stored));
+    cmap_entry entry = fscl_map_entry(map, key);
+    TEST_ASSERT_FALSE(fscl_map_entry_occupied(&entry));
+
+    // Walking the shards sees every pair once
+    long long sum = 0;
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_for_each(map, sum_values, &sum));
+    TEST_ASSERT_EQUAL(count * (count - 1) / 2 - 7 + 70, sum);
+
+    fscl_map_erase(map);
+}
+
+XTEST_CASE(test_map_read_mostly_mode) {
+    cmap* map = fscl_map_create_read_mostly(TOFU_INT_TYPE, 4);
+    TEST_ASSERT_NOT_CNULLPTR(map);
+    TEST_ASSERT_TRUE(fscl_map_is_empty(map));
+
+    const int count = 500;
+    for (int i = 0; i < count; i++) {
+        ctofu key = { TOFU_INT_TYPE, { .int_type = i } };
+        ctofu value = { TOFU_INT_TYPE, { .int_type = i * 2 } };
+        TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_insert(map, key, value));
+    }
+    TEST_ASSERT_EQUAL(count, fscl_map_size(map));
+
+    ctofu key = { TOFU_INT_TYPE, { .int_type = 9 } };
+    ctofu value = { TOFU_INT_TYPE, { .int_type = 90 } };
+    ctofu missingKey = { TOFU_INT_TYPE, { .int_type = -1 } };
+    ctofu result;
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_getter(map, key, &result));
+    TEST_ASSERT_EQUAL_INT(18, result.data.int_type);
+    TEST_ASSERT_EQUAL(TOFU_NOT_FOUND, fscl_map_getter(map, missingKey, &result));
+
+    // Failed writes leave the published pairs alone
+    TEST_ASSERT_EQUAL(TOFU_WAS_MISMATCH, fscl_map_insert(map, key, value));
+    TEST_ASSERT_EQUAL(TOFU_NOT_FOUND, fscl_map_remove(map, missingKey));
+    TEST_ASSERT_EQUAL(count, fscl_map_size(map));
+
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_setter(map, key, value));
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_getter(map, key, &result));
+    TEST_ASSERT_EQUAL_INT(90, result.data.int_type);
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_remove(map, key));
+    TEST_ASSERT_FALSE(fscl_map_contains(map, key));
+    TEST_ASSERT_EQUAL(count - 1, fscl_map_size(map));
+
+    long long sum = 0;
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_for_each(map, sum_values, &sum));
+    TEST_ASSERT_EQUAL(count * (count - 1) - 18, sum);
+
+    fscl_map_erase(map);
+}
+
+static MAP_TEST_THREAD_RETURN map_test_worker_run(void* arg) {
+    map_test_worker* worker = (map_test_worker*)arg;
+    ctofu result;
+
+    for (int i = 0; i < MAP_TEST_OWN_KEYS; i++) {
+        ctofu key = { TOFU_INT_TYPE, { .int_type = worker->first + i } };
+        worker->errors += fscl_map_insert(worker->map, key, key) != TOFU_SUCCESS;
+
+        // Keys written by no one stay readable while others write
+        ctofu shared = { TOFU_INT_TYPE, { .int_type = -1 - i % MAP_TEST_SHARED_KEYS } };
+        worker->errors += fscl_map_getter(worker->map, shared, &result) != TOFU_SUCCESS ||
+                          result.data.int_type != shared.data.int_type;
+
+        // Other ranges may or may not hold a key yet
+        ctofu other = { TOFU_INT_TYPE, { .int_type = (worker->first + MAP_TEST_OWN_KEYS + i) % (MAP_TEST_THREADS * MAP_TEST_OWN_KEYS) } };
+        fscl_map_contains(worker->map, other);
+    }
+
+    // Drop the odd keys, negate the even ones
+    for (int i = 0; i < MAP_TEST_OWN_KEYS; i++) {
+        ctofu key = { TOFU_INT_TYPE, { .int_type = worker->first + i } };
+        if (i % 2 != 0) {
+            worker->errors += fscl_map_remove(worker->map, key) != TOFU_SUCCESS;
+        } else {
+            ctofu value = { TOFU_INT_TYPE, { .int_type = -key.data.int_type } };
+            worker->errors += fscl_map_setter(worker->map, key, value) != TOFU_SUCCESS;
+        }
+        worker->errors += fscl_map_getter(worker->map, key, &result) != (i % 2 != 0 ? TOFU_NOT_FOUND : TOFU_SUCCESS);
+    }
+
+    return 0;
+}
+
+// Helper function to run MAP_TEST_THREADS workers against map and check
+// the pairs they leave behind
+static void map_test_threads(cmap* map) {
+    for (int i = 0; i < MAP_TEST_SHARED_KEYS; i++) {
+        ctofu shared = { TOFU_INT_TYPE, { .int_type = -1 - i } };
+        TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_insert(map, shared, shared));
+    }
+
+    map_test_thread handles[MAP_TEST_THREADS];
+    map_test_worker workers[MAP_TEST_THREADS];
+    for (int t = 0; t < MAP_TEST_THREADS; t++) {
+        workers[t].map = map;
+        workers[t].first = t * MAP_TEST_OWN_KEYS;
+        workers[t].errors = 0;
+#if defined(_WIN32)
+        handles[t] = CreateThread(NULL, 0, map_test_worker_run, &workers[t], 0, NULL);
+        TEST_ASSERT_NOT_CNULLPTR(handles[t]);
+#else
+        TEST_ASSERT_EQUAL_INT(0, pthread_create(&handles[t], NULL, map_test_worker_run, &workers[t]));
+#endif
+    }
+    for (int t = 0; t < MAP_TEST_THREADS; t++) {
+#if defined(_WIN32)
+        WaitForSingleObject(handles[t], INFINITE);
+        CloseHandle(handles[t]);
+#else
+        pthread_join(handles[t], NULL);
+#endif
+        TEST_ASSERT_EQUAL_UINT(0, workers[t].errors);
+    }
+
+    TEST_ASSERT_EQUAL_UINT(MAP_TEST_SHARED_KEYS + MAP_TEST_THREADS * MAP_TEST_OWN_KEYS / 2, fscl_map_size(map));
+    for (int i = 0; i < MAP_TEST_THREADS * MAP_TEST_OWN_KEYS; i++) {
+        ctofu key = { TOFU_INT_TYPE, { .int_type = i } };
+        ctofu result;
+        if (i % 2 != 0) {
+            TEST_ASSERT_FALSE(fscl_map_contains(map, key));
+        } else {
+            TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_getter(map, key, &result));
+            TEST_ASSERT_EQUAL_INT(-i, result.data.int_type);
+        }
+    }
+
+    long long sum = 0;
+    const long long pairs = MAP_TEST_THREADS * MAP_TEST_OWN_KEYS;
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_for_each(map, sum_values, &sum));
+    TEST_ASSERT_TRUE(sum == -(pairs / 2) * (pairs / 2 - 1) - (long long)MAP_TEST_SHARED_KEYS * (MAP_TEST_SHARED_KEYS + 1) / 2);
+}
+
+XTEST_CASE(test_map_concurrent_threads) {
+    cmap* sharded = fscl_map_create_concurrent(TOFU_INT_TYPE, 8);
+    TEST_ASSERT_NOT_CNULLPTR(sharded);
+    map_test_threads(sharded);
+    fscl_map_erase(sharded);
+
+    cmap* read_mostly = fscl_map_create_read_mostly(TOFU_INT_TYPE, 4);
+    TEST_ASSERT_NOT_CNULLPTR(read_mostly);
+    map_test_threads(read_mostly);
+    fscl_map_erase(read_mostly);
+}
+
+XTEST_CASE(test_map_freeze) {
+    cmap* map = fscl_map_create(TOFU_INT_TYPE);
+
+    // An empty map freezes to an empty frozen map
+    cmap_frozen* frozen = fscl_map_freeze(map);
+    TEST_ASSERT_NOT_CNULLPTR(frozen);
+    TEST_ASSERT_EQUAL(0, fscl_map_frozen_size(frozen));
+    ctofu missingKey = { TOFU_INT_TYPE, { .int_type = -1 } };
+    TEST_ASSERT_FALSE(fscl_map_frozen_contains(frozen, missingKey));
+    fscl_map_frozen_erase(frozen);
+
+    const int count = 5000;
+    for (int i = 0; i < count; i++) {
+        ctofu key = { TOFU_INT_TYPE, { .int_type = i * 3 } };
+        ctofu value = { TOFU_INT_TYPE, { .int_type = i } };
+        fscl_map_insert(map, key, value);
+    }
+
+    frozen = fscl_map_freeze(map);
+    fscl_map_erase(map);
+    TEST_ASSERT_NOT_CNULLPTR(frozen);
+    TEST_ASSERT_EQUAL(count, fscl_map_frozen_size(frozen));
+
+    // Every key has its own slot and keys in between are rejected
+    for (int i = 0; i < count; i++) {
+        ctofu key = { TOFU_INT_TYPE, { .int_type = i * 3 } };
+        ctofu absentKey = { TOFU_INT_TYPE, { .int_type = i * 3 + 1 } };
+        ctofu result;
+        TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_frozen_getter(frozen, key, &result));
+        TEST_ASSERT_EQUAL_INT(i, result.data.int_type);
+        TEST_ASSERT_CNULLPTR(fscl_map_frozen_find(frozen, &absentKey));
+    }
+    ctofu unused;
+    TEST_ASSERT_EQUAL(TOFU_NOT_FOUND, fscl_map_frozen_getter(frozen, missingKey, &unused));
+
+    fscl_map_frozen_erase(frozen);
+}
+
+XTEST_CASE(test_map_insert_many) {
+    enum { count = 1000 };
+    ctofu keys[count];
+    ctofu values[count];
+    for (int i = 0; i < count; i++) {
+        keys[i].type = TOFU_INT_TYPE;
+        keys[i].data.int_type = i;
+        values[i].type = TOFU_INT_TYPE;
+        values[i].data.int_type = i * 2;
+    }
+
+    cmap* map = fscl_map_create(TOFU_INT_TYPE);
+    TEST_ASSERT_NOT_CNULLPTR(map);
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_insert_many(map, keys, values, count));
+    TEST_ASSERT_EQUAL(count, fscl_map_size(map));
+
+    ctofu result;
+    for (int i = 0; i < count; i++) {
+        TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_getter(map, keys[i], &result));
+        TEST_ASSERT_EQUAL_INT(i * 2, result.data.int_type);
+    }
+
+    // Keys already present keep their first value
+    values[0].data.int_type = -1;
+    TEST_ASSERT_EQUAL(TOFU_WAS_MISMATCH, fscl_map_insert_many(map, keys, values, 1));
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_getter(map, keys[0], &result));
+    TEST_ASSERT_EQUAL_INT(0, result.data.int_type);
+    values[0].data.int_type = 0;
+    fscl_map_erase(map);
+
+    // Concurrent maps group the pairs by shard
+    map = fscl_map_create_read_mostly(TOFU_INT_TYPE, 4);
+    TEST_ASSERT_NOT_CNULLPTR(map);
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_insert_many(map, keys, values, count / 2));
+    TEST_ASSERT_EQUAL(TOFU_WAS_MISMATCH, fscl_map_insert_many(map, keys, values, count));
+    TEST_ASSERT_EQUAL(count, fscl_map_size(map));
+
+    long long sum = 0;
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_for_each(map, sum_values, &sum));
+    TEST_ASSERT_EQUAL(count * (count - 1), sum);
+
+    fscl_map_erase(map);
+}
+
+XTEST_CASE(test_map_from_vectors) {
+    cvector keys = fscl_vector_create(TOFU_INT_TYPE);
+    cvector values = fscl_vector_create(TOFU_INT_TYPE);
+    for (int i = 0; i < 100; i++) {
+        ctofu key = { TOFU_INT_TYPE, { .int_type = i % 50 } };
+        ctofu value = { TOFU_INT_TYPE, { .int_type = i } };
+        fscl_vector_push_back(&keys, key);
+        fscl_vector_push_back(&values, value);
+    }
+
+    // Repeated keys keep the value they were first paired with
+    cmap* map = fscl_map_from_vectors(&keys, &values);
+    TEST_ASSERT_NOT_CNULLPTR(map);
+    TEST_ASSERT_EQUAL(50, fscl_map_size(map));
+
+    ctofu key = { TOFU_INT_TYPE, { .int_type = 7 } };
+    ctofu result;
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_getter(map, key, &result));
+    TEST_ASSERT_EQUAL_INT(7, result.data.int_type);
+    fscl_map_erase(map);
+
+    // Vectors of different sizes do not pair up
+    ctofu extra = { TOFU_INT_TYPE, { .int_type = 100 } };
+    fscl_vector_push_back(&values, extra);
+    TEST_ASSERT_CNULLPTR(fscl_map_from_vectors(&keys, &values));
+
+    fscl_vector_erase(&keys);
+    fscl_vector_erase(&values);
+}
+
+XTEST_CASE(test_map_get_many) {
+    enum { count = 100 };
+    ctofu keys[count];
+    ctofu values[count];
+    bool found[count];
+    for (int i = 0; i < count; i++) {
+        keys[i].type = TOFU_INT_TYPE;
+        keys[i].data.int_type = i;
+        values[i].type = TOFU_INT_TYPE;
+        values[i].data.int_type = -1;
+    }
+
+    cmap* plain = fscl_map_create(TOFU_INT_TYPE);
+    cmap* sharded = fscl_map_create_concurrent(TOFU_INT_TYPE, 4);
+    TEST_ASSERT_NOT_CNULLPTR(plain);
+    TEST_ASSERT_NOT_CNULLPTR(sharded);
+
+    // Only the even keys are stored
+    for (int i = 0; i < count; i += 2) {
+        ctofu value = { TOFU_INT_TYPE, { .int_type = i * 10 } };
+        fscl_map_insert(plain, keys[i], value);
+        fscl_map_insert(sharded, keys[i], value);
+    }
+
+    TEST_ASSERT_EQUAL(TOFU_NOT_FOUND, fscl_map_get_many(plain, keys, count, values, found));
+    for (int i = 0; i < count; i++) {
+        TEST_ASSERT_EQUAL(i % 2 == 0, found[i]);
+        TEST_ASSERT_EQUAL_INT(i % 2 == 0 ? i * 10 : -1, values[i].data.int_type);
+        values[i].data.int_type = -1;
+    }
+
+    TEST_ASSERT_EQUAL(TOFU_NOT_FOUND, fscl_map_get_many(sharded, keys, count, values, found));
+    for (int i = 0; i < count; i++) {
+        TEST_ASSERT_EQUAL(i % 2 == 0, found[i]);
+        TEST_ASSERT_EQUAL_INT(i % 2 == 0 ? i * 10 : -1, values[i].data.int_type);
+    }
+
+    // Stored keys alone are all found, out_found is optional
+    ctofu evenKeys[count / 2];
+    for (int i = 0; i < count / 2; i++) {
+        evenKeys[i] = keys[i * 2];
+    }
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_get_many(plain, evenKeys, count / 2, values, NULL));
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_map_get_many(sharded, evenKeys, count / 2, values, NULL));
+    TEST_ASSERT_EQUAL_INT(20, values[1].data.int_type);
+
+    fscl_map_erase(plain);
+    fscl_map_erase(sharded);
+}
+
 //
 // XUNIT-TEST RUNNER
 //
@@ -128,4 +738,18 @@ XTEST_DEFINE_POOL(xdata_test_map_group) {
     XTEST_RUN_UNIT(test_map_remove);
     XTEST_RUN_UNIT(test_map_getter_and_setter);
     XTEST_RUN_UNIT(test_map_contains);
+    XTEST_RUN_UNIT(test_map_grows_past_initial_capacity);
+    XTEST_RUN_UNIT(test_map_remove_and_iterate);
+    XTEST_RUN_UNIT(test_map_swiss_mode);
+    XTEST_RUN_UNIT(test_map_incremental_resize);
+    XTEST_RUN_UNIT(test_map_entry_and_upsert);
+    XTEST_RUN_UNIT(test_map_entry_during_migration);
+    XTEST_RUN_UNIT(test_map_find_by_reference);
+    XTEST_RUN_UNIT(test_map_concurrent_mode);
+    XTEST_RUN_UNIT(test_map_read_mostly_mode);
+    XTEST_RUN_UNIT(test_map_concurrent_threads);
+    XTEST_RUN_UNIT(test_map_freeze);
+    XTEST_RUN_UNIT(test_map_insert_many);
+    XTEST_RUN_UNIT(test_map_from_vectors);
+    XTEST_RUN_UNIT(test_map_get_many);
 } // end of func
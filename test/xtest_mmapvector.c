@@ -0,0 +1,107 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/xstructures/mmapvector.h" // lib source code
+
+#include <fossil/xtest.h>   // basic test tools
+#include <fossil/xassert.h> // extra asserts
+#include <stdio.h>
+
+// Scratch file of the test cases, created in the working directory
+#define TEST_MMAP_PATH "xtest_mmapvector.bin"
+
+//
+// XUNIT TEST CASES
+//
+XTEST_CASE(test_mmapvector_create_and_reopen) {
+    cvector_mmap vector;
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_mmap_open(&vector, TEST_MMAP_PATH, TOFU_INT_TYPE, VECTOR_MMAP_CREATE));
+    TEST_ASSERT_TRUE(fscl_vector_mmap_is_empty(&vector));
+
+    // Push past the first growth of the file
+    for (int i = 0; i < 10000; i++) {
+        ctofu element = { TOFU_INT_TYPE, { .int_type = i * 3 } };
+        TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_mmap_push_back(&vector, element));
+    }
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_mmap_sync(&vector));
+    fscl_vector_mmap_close(&vector);
+
+    // The elements are still there when the file is opened again
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_mmap_open(&vector, TEST_MMAP_PATH, TOFU_INT_TYPE, VECTOR_MMAP_READ));
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_mmap_advise(&vector, VECTOR_MMAP_SEQUENTIAL));
+    TEST_ASSERT_EQUAL_UINT(10000, fscl_vector_mmap_size(&vector));
+    TEST_ASSERT_EQUAL_INT(29997, fscl_vector_mmap_getter(&vector, 9999).data.int_type);
+    TEST_ASSERT_EQUAL_INT(300, ((const int*)fscl_vector_mmap_payloads(&vector))[100]);
+
+    ctofu target = { TOFU_INT_TYPE, { .int_type = 1500 } };
+    ctofu missing = { TOFU_INT_TYPE, { .int_type = 1501 } };
+    TEST_ASSERT_EQUAL_INT(500, fscl_vector_mmap_search(&vector, target));
+    TEST_ASSERT_EQUAL_INT(-1, fscl_vector_mmap_search(&vector, missing));
+
+    // Indexes come back as size_t, whatever the size of the file
+    size_t indexes[2];
+    TEST_ASSERT_EQUAL_UINT(1, fscl_vector_mmap_find_all(&vector, target, indexes, 2));
+    TEST_ASSERT_EQUAL_UINT(500, indexes[0]);
+    TEST_ASSERT_EQUAL_UINT(0, fscl_vector_mmap_find_all(&vector, missing, indexes, 2));
+
+    // A read-only vector rejects writes
+    TEST_ASSERT_EQUAL(TOFU_WAS_MISMATCH, fscl_vector_mmap_push_back(&vector, target));
+    TEST_ASSERT_EQUAL(TOFU_WAS_MISMATCH, fscl_vector_mmap_setter(&vector, 0, target));
+    fscl_vector_mmap_close(&vector);
+
+    // Write mode appends to the existing elements
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_mmap_open(&vector, TEST_MMAP_PATH, TOFU_INT_TYPE, VECTOR_MMAP_WRITE));
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_mmap_push_back(&vector, missing));
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_mmap_setter(&vector, 0, target));
+    TEST_ASSERT_EQUAL_UINT(10001, fscl_vector_mmap_size(&vector));
+    TEST_ASSERT_EQUAL_INT(1500, fscl_vector_mmap_getter(&vector, 0).data.int_type);
+    TEST_ASSERT_EQUAL(TOFU_INVALID_TYPE, fscl_vector_mmap_getter(&vector, 10001).type);
+    TEST_ASSERT_EQUAL_UINT(2, fscl_vector_mmap_find_all(&vector, target, indexes, 2));
+    TEST_ASSERT_EQUAL_UINT(0, indexes[0]);
+    TEST_ASSERT_EQUAL_UINT(500, indexes[1]);
+    fscl_vector_mmap_close(&vector);
+
+    remove(TEST_MMAP_PATH);
+}
+
+XTEST_CASE(test_mmapvector_types) {
+    cvector_mmap vector;
+
+    // A file of one type does not open as another
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_mmap_open(&vector, TEST_MMAP_PATH, TOFU_DOUBLE_TYPE, VECTOR_MMAP_CREATE));
+    cvector source = fscl_vector_create(TOFU_DOUBLE_TYPE);
+    for (int i = 0; i < 100; i++) {
+        ctofu element = { TOFU_DOUBLE_TYPE, { .double_type = i * 0.25 } };
+        fscl_vector_push_back(&source, element);
+    }
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_mmap_extend(&vector, &source));
+    ctofu target = { TOFU_DOUBLE_TYPE, { .double_type = 12.5 } };
+    TEST_ASSERT_EQUAL_INT(50, fscl_vector_mmap_search(&vector, target));
+    fscl_vector_mmap_close(&vector);
+
+    TEST_ASSERT_EQUAL(TOFU_WAS_MISMATCH, fscl_vector_mmap_open(&vector, TEST_MMAP_PATH, TOFU_INT_TYPE, VECTOR_MMAP_READ));
+
+    // Pointer payloads cannot be stored, and missing files cannot be read
+    TEST_ASSERT_EQUAL(TOFU_WAS_MISMATCH, fscl_vector_mmap_open(&vector, TEST_MMAP_PATH, TOFU_STRING_TYPE, VECTOR_MMAP_WRITE));
+    remove(TEST_MMAP_PATH);
+    TEST_ASSERT_EQUAL(TOFU_NOT_FOUND, fscl_vector_mmap_open(&vector, TEST_MMAP_PATH, TOFU_DOUBLE_TYPE, VECTOR_MMAP_READ));
+
+    fscl_vector_erase(&source);
+}
+
+//
+// XUNIT-TEST RUNNER
+//
+XTEST_DEFINE_POOL(xdata_test_mmapvector_group) {
+    XTEST_RUN_UNIT(test_mmapvector_create_and_reopen);
+    XTEST_RUN_UNIT(test_mmapvector_types);
+} // end of func
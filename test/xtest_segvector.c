@@ -0,0 +1,105 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/xstructures/segvector.h" // lib source code
+
+#include <fossil/xtest.h>   // basic test tools
+#include <fossil/xassert.h> // extra asserts
+
+//
+// XUNIT TEST CASES
+//
+XTEST_CASE(test_segvector_create_and_erase) {
+    cvector_segmented vector = fscl_vector_segmented_create(TOFU_INT_TYPE);
+
+    // Nothing is allocated before the first push
+    TEST_ASSERT_EQUAL_UINT(0, vector.chunk_count);
+    TEST_ASSERT_EQUAL_UINT(0, fscl_vector_segmented_capacity(&vector));
+    TEST_ASSERT_TRUE(fscl_vector_segmented_is_empty(&vector));
+
+    ctofu element = { TOFU_INT_TYPE, { .int_type = 1 } };
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_segmented_push_back(&vector, element));
+    TEST_ASSERT_EQUAL_UINT(1, vector.chunk_count);
+    TEST_ASSERT_EQUAL_UINT(16, fscl_vector_segmented_capacity(&vector));
+
+    fscl_vector_segmented_erase(&vector);
+
+    // Check if the vector is erased
+    TEST_ASSERT_EQUAL_UINT(0, vector.chunk_count);
+    TEST_ASSERT_EQUAL_UINT(0, vector.size);
+}
+
+XTEST_CASE(test_segvector_stable_addresses) {
+    cvector_segmented vector = fscl_vector_segmented_create(TOFU_INT_TYPE);
+    ctofu* first = NULL;
+    ctofu* middle = NULL;
+
+    for (int i = 0; i < 5000; i++) {
+        ctofu element = { TOFU_INT_TYPE, { .int_type = i } };
+        TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_segmented_push_back(&vector, element));
+        if (i == 0) {
+            first = fscl_vector_segmented_at(&vector, 0);
+        } else if (i == 100) {
+            middle = fscl_vector_segmented_at(&vector, 100);
+        }
+    }
+
+    // Pointers taken before later chunks were added still point at the elements
+    TEST_ASSERT_TRUE(first == fscl_vector_segmented_at(&vector, 0));
+    TEST_ASSERT_TRUE(middle == fscl_vector_segmented_at(&vector, 100));
+    TEST_ASSERT_EQUAL_INT(0, first->data.int_type);
+    TEST_ASSERT_EQUAL_INT(100, middle->data.int_type);
+
+    // Every index lands on its element across chunk boundaries
+    TEST_ASSERT_EQUAL_UINT(5000, fscl_vector_segmented_size(&vector));
+    for (int i = 0; i < 5000; i++) {
+        TEST_ASSERT_EQUAL_INT(i, fscl_vector_segmented_getter(&vector, i).data.int_type);
+    }
+    TEST_ASSERT_CNULLPTR(fscl_vector_segmented_at(&vector, 5000));
+
+    fscl_vector_segmented_erase(&vector);
+}
+
+XTEST_CASE(test_segvector_access_and_search) {
+    cvector_segmented vector = fscl_vector_segmented_create(TOFU_INT_TYPE);
+    for (int i = 0; i < 100; i++) {
+        ctofu element = { TOFU_INT_TYPE, { .int_type = i * 2 } };
+        fscl_vector_segmented_push_back(&vector, element);
+    }
+
+    ctofu wrong = { TOFU_DOUBLE_TYPE, { .double_type = 1.0 } };
+    ctofu element = { TOFU_INT_TYPE, { .int_type = -1 } };
+    TEST_ASSERT_EQUAL(TOFU_WAS_MISMATCH, fscl_vector_segmented_push_back(&vector, wrong));
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_segmented_setter(&vector, 50, element));
+    TEST_ASSERT_EQUAL(TOFU_WAS_BAD_RANGE, fscl_vector_segmented_setter(&vector, 100, element));
+    TEST_ASSERT_EQUAL(TOFU_INVALID_TYPE, fscl_vector_segmented_getter(&vector, 100).type);
+
+    // Matches are found in the first chunk and in later ones
+    ctofu early = { TOFU_INT_TYPE, { .int_type = 6 } };
+    ctofu late = { TOFU_INT_TYPE, { .int_type = 198 } };
+    ctofu missing = { TOFU_INT_TYPE, { .int_type = 7 } };
+    TEST_ASSERT_EQUAL_INT(3, fscl_vector_segmented_search(&vector, early));
+    TEST_ASSERT_EQUAL_INT(99, fscl_vector_segmented_search(&vector, late));
+    TEST_ASSERT_EQUAL_INT(50, fscl_vector_segmented_search(&vector, element));
+    TEST_ASSERT_EQUAL_INT(-1, fscl_vector_segmented_search(&vector, missing));
+
+    fscl_vector_segmented_erase(&vector);
+}
+
+//
+// XUNIT-TEST RUNNER
+//
+XTEST_DEFINE_POOL(xdata_test_segvector_group) {
+    XTEST_RUN_UNIT(test_segvector_create_and_erase);
+    XTEST_RUN_UNIT(test_segvector_stable_addresses);
+    XTEST_RUN_UNIT(test_segvector_access_and_search);
+} // end of func
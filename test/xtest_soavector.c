@@ -0,0 +1,113 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/xstructures/soavector.h" // lib source code
+
+#include <fossil/xtest.h>   // basic test tools
+#include <fossil/xassert.h> // extra asserts
+
+//
+// XUNIT TEST CASES
+//
+XTEST_CASE(test_soavector_create_and_erase) {
+    cvector_soa vector = fscl_vector_soa_create(TOFU_INT_TYPE);
+
+    // Nothing is allocated before the first push, and ints pack tightly
+    TEST_ASSERT_CNULLPTR(vector.payloads);
+    TEST_ASSERT_EQUAL_UINT(sizeof(int), vector.width);
+    TEST_ASSERT_TRUE(fscl_vector_soa_is_empty(&vector));
+
+    ctofu element = { TOFU_INT_TYPE, { .int_type = 1 } };
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_soa_push_back(&vector, element));
+    TEST_ASSERT_TRUE(fscl_vector_soa_not_empty(&vector));
+
+    fscl_vector_soa_erase(&vector);
+
+    // Check if the vector is erased
+    TEST_ASSERT_CNULLPTR(vector.payloads);
+    TEST_ASSERT_EQUAL_UINT(0, vector.size);
+    TEST_ASSERT_EQUAL_UINT(0, vector.capacity);
+}
+
+XTEST_CASE(test_soavector_push_back_and_access) {
+    cvector_soa vector = fscl_vector_soa_create(TOFU_DOUBLE_TYPE);
+    for (int i = 0; i < 100; i++) {
+        ctofu element = { TOFU_DOUBLE_TYPE, { .double_type = i * 0.5 } };
+        TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_soa_push_back(&vector, element));
+    }
+
+    ctofu wrong = { TOFU_INT_TYPE, { .int_type = 1 } };
+    ctofu element = { TOFU_DOUBLE_TYPE, { .double_type = -1.0 } };
+    TEST_ASSERT_EQUAL(TOFU_WAS_MISMATCH, fscl_vector_soa_push_back(&vector, wrong));
+    TEST_ASSERT_EQUAL_UINT(100, fscl_vector_soa_size(&vector));
+
+    // Elements come back whole, tag and payload
+    ctofu got = fscl_vector_soa_getter(&vector, 99);
+    TEST_ASSERT_EQUAL(TOFU_DOUBLE_TYPE, got.type);
+    TEST_ASSERT_TRUE(got.data.double_type == 49.5);
+    TEST_ASSERT_TRUE(((const double*)fscl_vector_soa_payloads(&vector))[10] == 5.0);
+
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_soa_setter(&vector, 10, element));
+    TEST_ASSERT_TRUE(fscl_vector_soa_getter(&vector, 10).data.double_type == -1.0);
+    TEST_ASSERT_EQUAL(TOFU_WAS_BAD_RANGE, fscl_vector_soa_setter(&vector, 100, element));
+    TEST_ASSERT_EQUAL(TOFU_WAS_MISMATCH, fscl_vector_soa_setter(&vector, 0, wrong));
+    TEST_ASSERT_EQUAL(TOFU_INVALID_TYPE, fscl_vector_soa_getter(&vector, 100).type);
+
+    fscl_vector_soa_erase(&vector);
+}
+
+XTEST_CASE(test_soavector_search) {
+    cvector source = fscl_vector_create(TOFU_INT_TYPE);
+    for (int i = 0; i < 75; i++) {
+        ctofu element = { TOFU_INT_TYPE, { .int_type = i % 10 } };
+        fscl_vector_push_back(&source, element);
+    }
+
+    cvector_soa vector = fscl_vector_soa_create(TOFU_INT_TYPE);
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_soa_extend(&vector, &source));
+    TEST_ASSERT_EQUAL_UINT(75, fscl_vector_soa_size(&vector));
+
+    // Matches in whole SIMD blocks and in the tail are found in order
+    ctofu target = { TOFU_INT_TYPE, { .int_type = 4 } };
+    ctofu missing = { TOFU_INT_TYPE, { .int_type = 10 } };
+    size_t indexes[8];
+    TEST_ASSERT_EQUAL_UINT(8, fscl_vector_soa_find_all(&vector, target, indexes, 8));
+    TEST_ASSERT_EQUAL_UINT(74, indexes[7]);
+    TEST_ASSERT_EQUAL_INT(4, fscl_vector_soa_search(&vector, target));
+    TEST_ASSERT_EQUAL_INT(-1, fscl_vector_soa_search(&vector, missing));
+
+    // Other types are compared element by element
+    char hello[] = "hello";
+    char world[] = "world";
+    cvector_soa strings = fscl_vector_soa_create(TOFU_STRING_TYPE);
+    ctofu first = { TOFU_STRING_TYPE, { .string_type = hello } };
+    ctofu second = { TOFU_STRING_TYPE, { .string_type = world } };
+    fscl_vector_soa_push_back(&strings, first);
+    fscl_vector_soa_push_back(&strings, second);
+    TEST_ASSERT_EQUAL_INT(1, fscl_vector_soa_search(&strings, second));
+
+    cvector_soa doubles = fscl_vector_soa_create(TOFU_DOUBLE_TYPE);
+    TEST_ASSERT_EQUAL(TOFU_WAS_MISMATCH, fscl_vector_soa_extend(&doubles, &source));
+
+    fscl_vector_erase(&source);
+    fscl_vector_soa_erase(&vector);
+    fscl_vector_soa_erase(&strings);
+}
+
+//
+// XUNIT-TEST RUNNER
+//
+XTEST_DEFINE_POOL(xdata_test_soavector_group) {
+    XTEST_RUN_UNIT(test_soavector_create_and_erase);
+    XTEST_RUN_UNIT(test_soavector_push_back_and_access);
+    XTEST_RUN_UNIT(test_soavector_search);
+} // end of func
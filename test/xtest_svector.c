@@ -0,0 +1,117 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/xstructures/svector.h" // lib source code
+
+#include <fossil/xtest.h>   // basic test tools
+#include <fossil/xassert.h> // extra asserts
+
+//
+// XUNIT TEST CASES
+//
+XTEST_CASE(test_svector_create_and_erase) {
+    cvector_small vector = fscl_vector_small_create(TOFU_INT_TYPE);
+
+    // Check if the vector starts empty on its inline storage
+    TEST_ASSERT_CNULLPTR(vector.heap);
+    TEST_ASSERT_EQUAL_UINT(0, vector.size);
+    TEST_ASSERT_EQUAL_UINT(VECTOR_SMALL_INLINE, vector.capacity);
+    TEST_ASSERT_EQUAL(TOFU_INT_TYPE, vector.expected_type);
+    TEST_ASSERT_TRUE(fscl_vector_small_is_inline(&vector));
+    TEST_ASSERT_TRUE(fscl_vector_small_is_empty(&vector));
+
+    fscl_vector_small_erase(&vector);
+    TEST_ASSERT_CNULLPTR(vector.heap);
+    TEST_ASSERT_EQUAL_UINT(0, vector.size);
+}
+
+XTEST_CASE(test_svector_spill) {
+    cvector_small vector = fscl_vector_small_create(TOFU_INT_TYPE);
+
+    // Elements up to the inline capacity do not allocate
+    for (int i = 0; i < VECTOR_SMALL_INLINE; i++) {
+        ctofu element = { TOFU_INT_TYPE, { .int_type = i * 10 } };
+        TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_small_push_back(&vector, element));
+    }
+    TEST_ASSERT_TRUE(fscl_vector_small_is_inline(&vector));
+    TEST_ASSERT_TRUE(fscl_vector_small_data(&vector) == vector.inline_data);
+
+    // An inline vector can be copied by value
+    cvector_small copy = vector;
+    TEST_ASSERT_EQUAL_INT(30, fscl_vector_small_getter(&copy, 3).data.int_type);
+
+    // One more element moves everything to the heap
+    for (int i = VECTOR_SMALL_INLINE; i < 100; i++) {
+        ctofu element = { TOFU_INT_TYPE, { .int_type = i * 10 } };
+        TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_small_push_back(&vector, element));
+    }
+    TEST_ASSERT_FALSE(fscl_vector_small_is_inline(&vector));
+    TEST_ASSERT_EQUAL_UINT(100, fscl_vector_small_size(&vector));
+    for (int i = 0; i < 100; i++) {
+        TEST_ASSERT_EQUAL_INT(i * 10, fscl_vector_small_getter(&vector, i).data.int_type);
+    }
+
+    // Erasing returns the vector to inline storage
+    fscl_vector_small_erase(&vector);
+    TEST_ASSERT_TRUE(fscl_vector_small_is_inline(&vector));
+    TEST_ASSERT_EQUAL_UINT(VECTOR_SMALL_INLINE, vector.capacity);
+}
+
+XTEST_CASE(test_svector_access) {
+    cvector_small vector = fscl_vector_small_create(TOFU_INT_TYPE);
+    ctofu element1 = { TOFU_INT_TYPE, { .int_type = 42 } };
+    ctofu element2 = { TOFU_INT_TYPE, { .int_type = 10 } };
+    ctofu element3 = { TOFU_INT_TYPE, { .int_type = 5 } };
+    ctofu wrong = { TOFU_DOUBLE_TYPE, { .double_type = 1.0 } };
+
+    fscl_vector_small_push_back(&vector, element1);
+    fscl_vector_small_push_back(&vector, element2);
+    TEST_ASSERT_EQUAL(TOFU_WAS_MISMATCH, fscl_vector_small_push_back(&vector, wrong));
+    TEST_ASSERT_EQUAL_UINT(2, fscl_vector_small_size(&vector));
+
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_small_setter(&vector, 1, element3));
+    TEST_ASSERT_EQUAL_INT(5, fscl_vector_small_getter(&vector, 1).data.int_type);
+    TEST_ASSERT_EQUAL(TOFU_WAS_BAD_RANGE, fscl_vector_small_setter(&vector, 2, element3));
+    TEST_ASSERT_EQUAL(TOFU_WAS_MISMATCH, fscl_vector_small_setter(&vector, 0, wrong));
+    TEST_ASSERT_EQUAL(TOFU_INVALID_TYPE, fscl_vector_small_getter(&vector, 2).type);
+
+    fscl_vector_small_erase(&vector);
+}
+
+XTEST_CASE(test_svector_search_and_reverse) {
+    cvector_small vector = fscl_vector_small_create(TOFU_INT_TYPE);
+    for (int i = 0; i < 6; i++) {
+        ctofu element = { TOFU_INT_TYPE, { .int_type = i + 1 } };
+        fscl_vector_small_push_back(&vector, element);
+    }
+
+    ctofu target = { TOFU_INT_TYPE, { .int_type = 5 } };
+    ctofu missing = { TOFU_INT_TYPE, { .int_type = 7 } };
+    TEST_ASSERT_EQUAL_INT(4, fscl_vector_small_search(&vector, target));
+    TEST_ASSERT_EQUAL_INT(-1, fscl_vector_small_search(&vector, missing));
+
+    fscl_vector_small_reverse(&vector);
+    TEST_ASSERT_EQUAL_INT(1, fscl_vector_small_search(&vector, target));
+    TEST_ASSERT_EQUAL_INT(6, fscl_vector_small_getter(&vector, 0).data.int_type);
+
+    fscl_vector_small_erase(&vector);
+}
+
+//
+// XUNIT-TEST RUNNER
+//
+XTEST_DEFINE_POOL(xdata_test_svector_group) {
+    XTEST_RUN_UNIT(test_svector_create_and_erase);
+    XTEST_RUN_UNIT(test_svector_spill);
+    XTEST_RUN_UNIT(test_svector_access);
+    XTEST_RUN_UNIT(test_svector_search_and_reverse);
+} // end of func
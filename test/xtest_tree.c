@@ -80,6 +80,61 @@ XTEST_CASE(test_tree_remove) {
     fscl_tree_erase(tree);
 }
 
+// Helper of test_tree_balance: the height of a subtree, or -1 when a node
+// breaks the search order or the AVL balance
+static int test_tree_check(const ctree_node* node, const ctofu* low, const ctofu* high) {
+    if (node == NULL) {
+        return 0;
+    }
+
+    if ((low != NULL && fscl_tofu_compare(&node->data, low) <= 0) ||
+        (high != NULL && fscl_tofu_compare(&node->data, high) >= 0)) {
+        return -1;
+    }
+
+    int left = test_tree_check(node->left, low, &node->data);
+    int right = test_tree_check(node->right, &node->data, high);
+    if (left < 0 || right < 0 || left - right > 1 || right - left > 1) {
+        return -1;
+    }
+
+    int height = 1 + (left > right ? left : right);
+    return height == node->height ? height : -1;
+}
+
+XTEST_CASE(test_tree_balance) {
+    ctree* tree = fscl_tree_create(TOFU_INT_TYPE);
+
+    // Sequential keys would make an unbalanced tree a linked list
+    for (int i = 0; i < 4096; i++) {
+        ctofu element = { TOFU_INT_TYPE, { .int_type = i } };
+        TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_tree_insert(tree, element));
+    }
+    TEST_ASSERT_EQUAL_UINT(4096, fscl_tree_size(tree));
+    TEST_ASSERT_EQUAL_INT(13, test_tree_check(tree->root, NULL, NULL));
+
+    ctofu duplicate = { TOFU_INT_TYPE, { .int_type = 7 } };
+    ctofu wrong = { TOFU_DOUBLE_TYPE, { .double_type = 7.0 } };
+    TEST_ASSERT_EQUAL(TOFU_DUPLICATE_ELEMENT, fscl_tree_insert(tree, duplicate));
+    TEST_ASSERT_EQUAL(TOFU_WAS_MISMATCH, fscl_tree_insert(tree, wrong));
+
+    // Removing every other key keeps the tree balanced
+    for (int i = 0; i < 4096; i += 2) {
+        ctofu element = { TOFU_INT_TYPE, { .int_type = i } };
+        TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_tree_remove(tree, element));
+    }
+    TEST_ASSERT_EQUAL_UINT(2048, fscl_tree_size(tree));
+    int height = test_tree_check(tree->root, NULL, NULL);
+    TEST_ASSERT_TRUE(height > 0 && height <= 13);
+
+    for (int i = 0; i < 4096; i++) {
+        ctofu element = { TOFU_INT_TYPE, { .int_type = i } };
+        TEST_ASSERT_EQUAL(i % 2 ? TOFU_SUCCESS : TOFU_NOT_FOUND, fscl_tree_search(tree, element));
+    }
+
+    fscl_tree_erase(tree);
+}
+
 //
 // XUNIT-TEST RUNNER
 //
@@ -87,4 +142,5 @@ XTEST_DEFINE_POOL(xdata_test_tree_group) {
     XTEST_RUN_UNIT(test_tree_create_and_erase);
     XTEST_RUN_UNIT(test_tree_insert_and_search);
     XTEST_RUN_UNIT(test_tree_remove);
+    XTEST_RUN_UNIT(test_tree_balance);
 } // end of func
@@ -0,0 +1,143 @@
+/*
+==============================================================================
+Author: Michael Gene Brockus (Dreamer)
+Email: michaelbrockus@gmail.com
+Organization: Fossil Logic
+Description: 
+    This file is part of the Fossil Logic project, where innovation meets
+    excellence in software development. Michael Gene Brockus, also known as
+    "Dreamer," is a dedicated contributor to this project. For any inquiries,
+    feel free to contact Michael at michaelbrockus@gmail.com.
+==============================================================================
+*/
+#include "fossil/xstructures/tvector.h" // lib source code
+
+#include <fossil/xtest.h>   // basic test tools
+#include <fossil/xassert.h> // extra asserts
+
+//
+// XUNIT TEST CASES
+//
+XTEST_CASE(test_tvector_create_and_erase) {
+    cvector_i64 vector = fscl_vector_i64_create();
+
+    // Nothing is allocated before the first push
+    TEST_ASSERT_CNULLPTR(vector.data);
+    TEST_ASSERT_EQUAL_UINT(0, vector.size);
+    TEST_ASSERT_EQUAL_UINT(0, vector.capacity);
+    TEST_ASSERT_TRUE(fscl_vector_i64_is_empty(&vector));
+
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_i64_push_back(&vector, 1));
+    TEST_ASSERT_EQUAL_UINT(FSCL_VECTOR_TYPED_INITIAL_CAPACITY, vector.capacity);
+
+    fscl_vector_i64_erase(&vector);
+
+    // Check if the vector is erased
+    TEST_ASSERT_CNULLPTR(vector.data);
+    TEST_ASSERT_EQUAL_UINT(0, vector.size);
+    TEST_ASSERT_EQUAL_UINT(0, vector.capacity);
+}
+
+XTEST_CASE(test_tvector_push_back_and_access) {
+    cvector_i64 vector = fscl_vector_i64_create();
+
+    // Push past several capacity doublings
+    for (int64_t i = 0; i < 1000; i++) {
+        TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_i64_push_back(&vector, i * 3));
+    }
+    TEST_ASSERT_EQUAL_UINT(1000, fscl_vector_i64_size(&vector));
+    TEST_ASSERT_EQUAL_INT(2997, vector.data[999]);
+
+    int64_t element = 0;
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_i64_getter(&vector, 10, &element));
+    TEST_ASSERT_EQUAL_INT(30, element);
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_i64_setter(&vector, 10, -5));
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_i64_getter(&vector, 10, &element));
+    TEST_ASSERT_EQUAL_INT(-5, element);
+
+    // Out of range accesses are rejected
+    TEST_ASSERT_EQUAL(TOFU_WAS_BAD_RANGE, fscl_vector_i64_getter(&vector, 1000, &element));
+    TEST_ASSERT_EQUAL(TOFU_WAS_BAD_RANGE, fscl_vector_i64_setter(&vector, 1000, 0));
+
+    fscl_vector_i64_erase(&vector);
+}
+
+XTEST_CASE(test_tvector_search_and_reverse) {
+    cvector_f64 vector = fscl_vector_f64_create();
+    fscl_vector_f64_push_back(&vector, 1.5);
+    fscl_vector_f64_push_back(&vector, 2.5);
+    fscl_vector_f64_push_back(&vector, 3.5);
+
+    TEST_ASSERT_EQUAL_INT(1, fscl_vector_f64_search(&vector, 2.5));
+    TEST_ASSERT_EQUAL_INT(-1, fscl_vector_f64_search(&vector, 4.0));
+
+    fscl_vector_f64_reverse(&vector);
+    TEST_ASSERT_EQUAL_INT(0, fscl_vector_f64_search(&vector, 3.5));
+    TEST_ASSERT_EQUAL_INT(2, fscl_vector_f64_search(&vector, 1.5));
+
+    // Reversing an empty vector is a no-op
+    cvector_f64 empty = fscl_vector_f64_create();
+    fscl_vector_f64_reverse(&empty);
+    TEST_ASSERT_TRUE(fscl_vector_f64_is_empty(&empty));
+
+    fscl_vector_f64_erase(&vector);
+}
+
+XTEST_CASE(test_tvector_pointers) {
+    int values[3] = { 1, 2, 3 };
+    cvector_ptr vector = fscl_vector_ptr_create();
+    for (int i = 0; i < 3; i++) {
+        fscl_vector_ptr_push_back(&vector, &values[i]);
+    }
+
+    TEST_ASSERT_EQUAL_INT(2, fscl_vector_ptr_search(&vector, &values[2]));
+    TEST_ASSERT_EQUAL_INT(-1, fscl_vector_ptr_search(&vector, NULL));
+
+    void* element = NULL;
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_ptr_getter(&vector, 1, &element));
+    TEST_ASSERT_EQUAL_INT(2, *(int*)element);
+
+    fscl_vector_ptr_erase(&vector);
+}
+
+XTEST_CASE(test_tvector_find_all) {
+    cvector_i32 ints = fscl_vector_i32_create();
+    cvector_u64 words = fscl_vector_u64_create();
+    cvector_f32 floats = fscl_vector_f32_create();
+    for (int32_t i = 0; i < 75; i++) {
+        fscl_vector_i32_push_back(&ints, i % 10);
+        fscl_vector_u64_push_back(&words, i % 10 == 9 ? UINT64_MAX : (uint64_t)i);
+        fscl_vector_f32_push_back(&floats, (float)(i % 10) * 0.5f);
+    }
+
+    // Matches in whole SIMD blocks and in the tail are found in order
+    size_t indexes[8];
+    TEST_ASSERT_EQUAL_UINT(7, fscl_vector_i32_find_all(&ints, 9, indexes, 8));
+    for (size_t i = 0; i < 7; i++) {
+        TEST_ASSERT_EQUAL_UINT(i * 10 + 9, indexes[i]);
+    }
+    TEST_ASSERT_EQUAL_UINT(7, fscl_vector_u64_find_all(&words, UINT64_MAX, indexes, 8));
+    TEST_ASSERT_EQUAL_UINT(69, indexes[6]);
+    TEST_ASSERT_EQUAL_UINT(8, fscl_vector_f32_find_all(&floats, 1.0f, indexes, 8));
+    TEST_ASSERT_EQUAL_UINT(72, indexes[7]);
+
+    // search stops at the first match
+    TEST_ASSERT_EQUAL_INT(9, fscl_vector_i32_search(&ints, 9));
+    TEST_ASSERT_EQUAL_INT(74, fscl_vector_u64_search(&words, 74));
+    TEST_ASSERT_EQUAL_INT(-1, fscl_vector_i32_search(&ints, 10));
+
+    fscl_vector_i32_erase(&ints);
+    fscl_vector_u64_erase(&words);
+    fscl_vector_f32_erase(&floats);
+}
+
+//
+// XUNIT-TEST RUNNER
+//
+XTEST_DEFINE_POOL(xdata_test_tvector_group) {
+    XTEST_RUN_UNIT(test_tvector_create_and_erase);
+    XTEST_RUN_UNIT(test_tvector_push_back_and_access);
+    XTEST_RUN_UNIT(test_tvector_search_and_reverse);
+    XTEST_RUN_UNIT(test_tvector_pointers);
+    XTEST_RUN_UNIT(test_tvector_find_all);
+} // end of func
@@ -80,6 +80,318 @@ XTEST_CASE(test_vector_search) {
     fscl_vector_erase(&vector);
 }
 
+XTEST_CASE(test_vector_find_all) {
+    cvector vector = fscl_vector_create(TOFU_INT_TYPE);
+
+    // Every seventh element matches, across whole SIMD blocks and the tail
+    for (int i = 0; i < 100; i++) {
+        ctofu element = { TOFU_INT_TYPE, { .int_type = i % 7 == 3 ? 42 : i + 100 } };
+        fscl_vector_push_back(&vector, element);
+    }
+
+    ctofu target = { TOFU_INT_TYPE, { .int_type = 42 } };
+    size_t indexes[20];
+    TEST_ASSERT_EQUAL_UINT(14, fscl_vector_find_all(&vector, target, indexes, 20));
+    for (size_t i = 0; i < 14; i++) {
+        TEST_ASSERT_EQUAL_UINT(i * 7 + 3, indexes[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(3, fscl_vector_search(&vector, target));
+
+    // Matches past the capacity are counted but not stored
+    TEST_ASSERT_EQUAL_UINT(14, fscl_vector_find_all(&vector, target, indexes, 2));
+    TEST_ASSERT_EQUAL_UINT(14, fscl_vector_find_all(&vector, target, NULL, 0));
+
+    ctofu missing = { TOFU_INT_TYPE, { .int_type = -1 } };
+    TEST_ASSERT_EQUAL_UINT(0, fscl_vector_find_all(&vector, missing, indexes, 20));
+    TEST_ASSERT_EQUAL_INT(-1, fscl_vector_search(&vector, missing));
+
+    fscl_vector_erase(&vector);
+
+    // Floating-point payloads take the SIMD kernels as well
+    cvector floats = fscl_vector_create(TOFU_FLOAT_TYPE);
+    cvector doubles = fscl_vector_create(TOFU_DOUBLE_TYPE);
+    for (int i = 0; i < 100; i++) {
+        ctofu single = { TOFU_FLOAT_TYPE, { .float_type = i % 7 == 3 ? 0.5f : i + 100.0f } };
+        ctofu wide = { TOFU_DOUBLE_TYPE, { .double_type = i % 7 == 3 ? 0.5 : i + 100.0 } };
+        fscl_vector_push_back(&floats, single);
+        fscl_vector_push_back(&doubles, wide);
+    }
+
+    ctofu single = { TOFU_FLOAT_TYPE, { .float_type = 0.5f } };
+    ctofu wide = { TOFU_DOUBLE_TYPE, { .double_type = 0.5 } };
+    TEST_ASSERT_EQUAL_UINT(14, fscl_vector_find_all(&floats, single, indexes, 20));
+    TEST_ASSERT_EQUAL_UINT(94, indexes[13]);
+    TEST_ASSERT_EQUAL_UINT(14, fscl_vector_find_all(&doubles, wide, indexes, 20));
+    TEST_ASSERT_EQUAL_UINT(94, indexes[13]);
+    TEST_ASSERT_EQUAL_INT(3, fscl_vector_search(&doubles, wide));
+    TEST_ASSERT_EQUAL_UINT(0, fscl_vector_find_all(&doubles, single, indexes, 20));
+
+    fscl_vector_erase(&floats);
+    fscl_vector_erase(&doubles);
+}
+
+XTEST_CASE(test_vector_capacity) {
+    cvector vector = fscl_vector_create(TOFU_INT_TYPE);
+
+    // Reserving makes room once and never shrinks
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_reserve(&vector, 100));
+    TEST_ASSERT_EQUAL_UINT(100, fscl_vector_capacity(&vector));
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_reserve(&vector, 50));
+    TEST_ASSERT_EQUAL_UINT(100, fscl_vector_capacity(&vector));
+
+    // Resizing appends copies of the fill element or drops the tail
+    ctofu fill = { TOFU_INT_TYPE, { .int_type = 7 } };
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_resize(&vector, 30, fill));
+    TEST_ASSERT_EQUAL_UINT(30, fscl_vector_size(&vector));
+    TEST_ASSERT_EQUAL_INT(7, vector.data[29].data.int_type);
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_resize(&vector, 20, fill));
+    TEST_ASSERT_EQUAL_UINT(20, fscl_vector_size(&vector));
+
+    ctofu wrongType = { TOFU_DOUBLE_TYPE, { .double_type = 1.0 } };
+    TEST_ASSERT_EQUAL(TOFU_WAS_MISMATCH, fscl_vector_resize(&vector, 40, wrongType));
+    TEST_ASSERT_EQUAL_UINT(20, fscl_vector_size(&vector));
+
+    // Shrinking gives back everything past the size
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_shrink_to_fit(&vector));
+    TEST_ASSERT_EQUAL_UINT(20, fscl_vector_capacity(&vector));
+
+    // Growth policies pick the next capacity of a full vector
+    TEST_ASSERT_EQUAL(TOFU_WAS_BAD_RANGE, fscl_vector_set_growth(&vector, VECTOR_GROWTH_STEP, 0));
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_set_growth(&vector, VECTOR_GROWTH_HALF, 0));
+    fscl_vector_push_back(&vector, fill);
+    TEST_ASSERT_EQUAL_UINT(30, fscl_vector_capacity(&vector));
+
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_shrink_to_fit(&vector));
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_set_growth(&vector, VECTOR_GROWTH_STEP, 4));
+    fscl_vector_push_back(&vector, fill);
+    TEST_ASSERT_EQUAL_UINT(25, fscl_vector_capacity(&vector));
+    TEST_ASSERT_EQUAL_UINT(22, fscl_vector_size(&vector));
+
+    // An erased vector grows again from nothing
+    fscl_vector_erase(&vector);
+    fscl_vector_push_back(&vector, fill);
+    TEST_ASSERT_EQUAL_UINT(1, fscl_vector_size(&vector));
+    TEST_ASSERT_TRUE(fscl_vector_capacity(&vector) >= 1);
+
+    fscl_vector_erase(&vector);
+}
+
+XTEST_CASE(test_vector_ranges) {
+    cvector vector = fscl_vector_create(TOFU_INT_TYPE);
+    ctofu elements[20];
+    for (int i = 0; i < 20; i++) {
+        elements[i].type = TOFU_INT_TYPE;
+        elements[i].data.int_type = i;
+    }
+
+    // Append grows past the initial capacity in one step
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_append(&vector, elements, 20));
+    TEST_ASSERT_EQUAL_UINT(20, fscl_vector_size(&vector));
+
+    // Insert shifts the tail right, erase shifts it back
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_insert_range(&vector, 5, elements, 3));
+    TEST_ASSERT_EQUAL_UINT(23, fscl_vector_size(&vector));
+    TEST_ASSERT_EQUAL_INT(4, vector.data[4].data.int_type);
+    TEST_ASSERT_EQUAL_INT(0, vector.data[5].data.int_type);
+    TEST_ASSERT_EQUAL_INT(2, vector.data[7].data.int_type);
+    TEST_ASSERT_EQUAL_INT(5, vector.data[8].data.int_type);
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_erase_range(&vector, 5, 3));
+    for (int i = 0; i < 20; i++) {
+        TEST_ASSERT_EQUAL_INT(i, vector.data[i].data.int_type);
+    }
+
+    // Ranges past the end and mistyped batches change nothing
+    TEST_ASSERT_EQUAL(TOFU_WAS_BAD_RANGE, fscl_vector_insert_range(&vector, 21, elements, 1));
+    TEST_ASSERT_EQUAL(TOFU_WAS_BAD_RANGE, fscl_vector_erase_range(&vector, 15, 6));
+    elements[1].type = TOFU_DOUBLE_TYPE;
+    TEST_ASSERT_EQUAL(TOFU_WAS_MISMATCH, fscl_vector_append(&vector, elements, 2));
+    TEST_ASSERT_EQUAL_UINT(20, fscl_vector_size(&vector));
+
+    // A vector can extend itself and insert its own elements
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_extend(&vector, &vector));
+    TEST_ASSERT_EQUAL_UINT(40, fscl_vector_size(&vector));
+    TEST_ASSERT_EQUAL_INT(19, vector.data[39].data.int_type);
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_insert_range(&vector, 0, &vector.data[38], 2));
+    TEST_ASSERT_EQUAL_INT(18, vector.data[0].data.int_type);
+    TEST_ASSERT_EQUAL_INT(0, vector.data[2].data.int_type);
+
+    cvector other = fscl_vector_create(TOFU_DOUBLE_TYPE);
+    TEST_ASSERT_EQUAL(TOFU_WAS_MISMATCH, fscl_vector_extend(&vector, &other));
+
+    fscl_vector_erase(&other);
+    fscl_vector_erase(&vector);
+}
+
+XTEST_CASE(test_vector_sort) {
+    // Large integer vectors take the radix path, negative values included
+    cvector ints = fscl_vector_create(TOFU_INT_TYPE);
+    long long sum = 0;
+    unsigned seed = 12345;
+    for (int i = 0; i < 1000; i++) {
+        seed = seed * 1103515245u + 12345u;
+        ctofu element = { TOFU_INT_TYPE, { .int_type = (int)(seed >> 8) % 2000 - 1000 } };
+        fscl_vector_push_back(&ints, element);
+        sum += element.data.int_type;
+    }
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_sort(&ints));
+    TEST_ASSERT_TRUE(fscl_vector_is_sorted(&ints));
+    for (size_t i = 0; i < ints.size; i++) {
+        sum -= ints.data[i].data.int_type;
+    }
+    TEST_ASSERT_EQUAL(0, sum);
+
+    // Other types go through introsort, here on reversed input
+    cvector doubles = fscl_vector_create(TOFU_DOUBLE_TYPE);
+    for (int i = 100; i > 0; i--) {
+        ctofu element = { TOFU_DOUBLE_TYPE, { .double_type = i * 0.5 } };
+        fscl_vector_push_back(&doubles, element);
+    }
+    TEST_ASSERT_FALSE(fscl_vector_is_sorted(&doubles));
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_sort(&doubles));
+    TEST_ASSERT_TRUE(fscl_vector_is_sorted(&doubles));
+    for (int i = 0; i < 100; i++) {
+        TEST_ASSERT_TRUE(doubles.data[i].data.double_type == (i + 1) * 0.5);
+    }
+
+    fscl_vector_erase(&ints);
+    fscl_vector_erase(&doubles);
+}
+
+XTEST_CASE(test_vector_sort_parallel) {
+    // Large enough to be split across four threads
+    const int count = 100000;
+    cvector ints = fscl_vector_create(TOFU_INT_TYPE);
+    cvector doubles = fscl_vector_create(TOFU_DOUBLE_TYPE);
+    unsigned seed = 777;
+    for (int i = 0; i < count; i++) {
+        seed = seed * 1103515245u + 12345u;
+        ctofu integer = { TOFU_INT_TYPE, { .int_type = (int)(seed >> 4) - (1 << 26) } };
+        ctofu real = { TOFU_DOUBLE_TYPE, { .double_type = (double)(seed % 5000) } };
+        fscl_vector_push_back(&ints, integer);
+        fscl_vector_push_back(&doubles, real);
+    }
+
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_sort_parallel(&ints, 4));
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_sort_parallel(&doubles, 4));
+    TEST_ASSERT_EQUAL_UINT(count, fscl_vector_size(&ints));
+    TEST_ASSERT_EQUAL_UINT(count, fscl_vector_size(&doubles));
+    TEST_ASSERT_TRUE(fscl_vector_is_sorted(&ints));
+    TEST_ASSERT_TRUE(fscl_vector_is_sorted(&doubles));
+
+    // Small vectors fall back to the sequential sort
+    cvector small = fscl_vector_create(TOFU_INT_TYPE);
+    for (int i = 10; i > 0; i--) {
+        ctofu element = { TOFU_INT_TYPE, { .int_type = i } };
+        fscl_vector_push_back(&small, element);
+    }
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_sort_parallel(&small, 0));
+    TEST_ASSERT_TRUE(fscl_vector_is_sorted(&small));
+
+    fscl_vector_erase(&ints);
+    fscl_vector_erase(&doubles);
+    fscl_vector_erase(&small);
+}
+
+// Callbacks of test_vector_parallel_scans
+static void test_vector_mark(const ctofu* element, void* context) {
+    ((unsigned char*)context)[element->data.int_type] = 1;
+}
+
+static void test_vector_sum(ctofu* accumulator, const ctofu* element, void* context) {
+    (void)context;
+    accumulator->data.int_type += element->data.int_type;
+}
+
+static bool test_vector_is_multiple(const ctofu* element, void* context) {
+    return element->data.int_type % *(int*)context == 0;
+}
+
+static ctofu test_vector_negate(const ctofu* element, void* context) {
+    (void)context;
+    ctofu result = { TOFU_INT_TYPE, { .int_type = -element->data.int_type } };
+    return result;
+}
+
+static ctofu test_vector_to_double(const ctofu* element, void* context) {
+    (void)context;
+    ctofu result = { TOFU_DOUBLE_TYPE, { .double_type = element->data.int_type } };
+    return result;
+}
+
+XTEST_CASE(test_vector_parallel_scans) {
+    // Large enough to be split across four threads
+    const int count = 50000;
+    cvector vector = fscl_vector_create(TOFU_INT_TYPE);
+    for (int i = 0; i < count; i++) {
+        ctofu element = { TOFU_INT_TYPE, { .int_type = i } };
+        fscl_vector_push_back(&vector, element);
+    }
+
+    // Every element is visited once
+    unsigned char* marks = (unsigned char*)calloc(count, 1);
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_for_each_parallel(&vector, test_vector_mark, marks, 4));
+    size_t marked = 0;
+    for (int i = 0; i < count; i++) {
+        marked += marks[i];
+    }
+    TEST_ASSERT_EQUAL_UINT(count, marked);
+    free(marks);
+
+    ctofu zero = { TOFU_INT_TYPE, { .int_type = 0 } };
+    ctofu sum;
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_reduce_parallel(&vector, test_vector_sum, zero, NULL, &sum, 4));
+    TEST_ASSERT_EQUAL_INT(count / 2 * (count - 1), sum.data.int_type);
+
+    // Kept elements stay in order, including when filtering into itself
+    int divisor = 7;
+    cvector multiples = fscl_vector_create(TOFU_INT_TYPE);
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_filter(&vector, test_vector_is_multiple, &divisor, &multiples, 4));
+    TEST_ASSERT_EQUAL_UINT((count + 6) / 7, fscl_vector_size(&multiples));
+    TEST_ASSERT_TRUE(fscl_vector_is_sorted(&multiples));
+    TEST_ASSERT_EQUAL_INT(49994, fscl_vector_getter(&multiples, fscl_vector_size(&multiples) - 1).data.int_type);
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_filter(&vector, test_vector_is_multiple, &divisor, &vector, 4));
+    TEST_ASSERT_EQUAL_UINT(count + (count + 6) / 7, fscl_vector_size(&vector));
+    TEST_ASSERT_EQUAL_INT(7, fscl_vector_getter(&vector, count + 1).data.int_type);
+
+    cvector doubles = fscl_vector_create(TOFU_DOUBLE_TYPE);
+    TEST_ASSERT_EQUAL(TOFU_WAS_MISMATCH, fscl_vector_filter(&vector, test_vector_is_multiple, &divisor, &doubles, 4));
+
+    TEST_ASSERT_EQUAL(TOFU_SUCCESS, fscl_vector_transform(&multiples, test_vector_negate, NULL, 4));
+    TEST_ASSERT_EQUAL_INT(-49994, fscl_vector_getter(&multiples, fscl_vector_size(&multiples) - 1).data.int_type);
+
+    // Results of the wrong type leave the elements unchanged
+    TEST_ASSERT_EQUAL(TOFU_WAS_MISMATCH, fscl_vector_transform(&multiples, test_vector_to_double, NULL, 4));
+    TEST_ASSERT_EQUAL_INT(-7, fscl_vector_getter(&multiples, 1).data.int_type);
+
+    fscl_vector_erase(&vector);
+    fscl_vector_erase(&multiples);
+    fscl_vector_erase(&doubles);
+}
+
+XTEST_CASE(test_vector_binary_search) {
+    cvector vector = fscl_vector_create(TOFU_INT_TYPE);
+
+    // 0, 0, 2, 2, 4, 4, ... 98, 98
+    for (int i = 0; i < 100; i++) {
+        ctofu element = { TOFU_INT_TYPE, { .int_type = i / 2 * 2 } };
+        fscl_vector_push_back(&vector, element);
+    }
+
+    ctofu present = { TOFU_INT_TYPE, { .int_type = 40 } };
+    ctofu absent = { TOFU_INT_TYPE, { .int_type = 41 } };
+    ctofu above = { TOFU_INT_TYPE, { .int_type = 1000 } };
+    TEST_ASSERT_EQUAL_UINT(40, fscl_vector_lower_bound(&vector, present));
+    TEST_ASSERT_EQUAL_UINT(42, fscl_vector_upper_bound(&vector, present));
+    TEST_ASSERT_EQUAL_UINT(42, fscl_vector_lower_bound(&vector, absent));
+    TEST_ASSERT_EQUAL_UINT(100, fscl_vector_upper_bound(&vector, above));
+
+    TEST_ASSERT_EQUAL_INT(40, fscl_vector_binary_search(&vector, present));
+    TEST_ASSERT_EQUAL_INT(-1, fscl_vector_binary_search(&vector, absent));
+    TEST_ASSERT_EQUAL_INT(-1, fscl_vector_binary_search(&vector, above));
+
+    fscl_vector_erase(&vector);
+}
+
 //
 // XUNIT-TEST RUNNER
 //
@@ -87,4 +399,11 @@ XTEST_DEFINE_POOL(xdata_test_vector_group) {
     XTEST_RUN_UNIT(test_vector_create_and_erase);
     XTEST_RUN_UNIT(test_vector_push_back);
     XTEST_RUN_UNIT(test_vector_search);
+    XTEST_RUN_UNIT(test_vector_find_all);
+    XTEST_RUN_UNIT(test_vector_capacity);
+    XTEST_RUN_UNIT(test_vector_ranges);
+    XTEST_RUN_UNIT(test_vector_sort);
+    XTEST_RUN_UNIT(test_vector_sort_parallel);
+    XTEST_RUN_UNIT(test_vector_binary_search);
+    XTEST_RUN_UNIT(test_vector_parallel_scans);
 } // end of func
@@ -25,6 +25,14 @@ XTEST_EXTERN_POOL(xdata_test_pqueue_group);
 XTEST_EXTERN_POOL(xdata_test_queue_group );
 XTEST_EXTERN_POOL(xdata_test_stack_group );
 XTEST_EXTERN_POOL(xdata_test_vector_group);
+XTEST_EXTERN_POOL(xdata_test_hash_group  );
+XTEST_EXTERN_POOL(xdata_test_cache_group );
+XTEST_EXTERN_POOL(xdata_test_btree_group );
+XTEST_EXTERN_POOL(xdata_test_tvector_group);
+XTEST_EXTERN_POOL(xdata_test_svector_group);
+XTEST_EXTERN_POOL(xdata_test_segvector_group);
+XTEST_EXTERN_POOL(xdata_test_soavector_group);
+XTEST_EXTERN_POOL(xdata_test_mmapvector_group);
 
 //
 // XUNIT-TEST RUNNER
@@ -42,6 +50,14 @@ int main(int argc, char **argv) {
     XTEST_IMPORT_POOL(xdata_test_queue_group );
     XTEST_IMPORT_POOL(xdata_test_stack_group );
     XTEST_IMPORT_POOL(xdata_test_vector_group);
+    XTEST_IMPORT_POOL(xdata_test_hash_group  );
+    XTEST_IMPORT_POOL(xdata_test_cache_group );
+    XTEST_IMPORT_POOL(xdata_test_btree_group );
+    XTEST_IMPORT_POOL(xdata_test_tvector_group);
+    XTEST_IMPORT_POOL(xdata_test_svector_group);
+    XTEST_IMPORT_POOL(xdata_test_segvector_group);
+    XTEST_IMPORT_POOL(xdata_test_soavector_group);
+    XTEST_IMPORT_POOL(xdata_test_mmapvector_group);
 
     return XTEST_ERASE();
 } // end of function main